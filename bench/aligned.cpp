@@ -0,0 +1,62 @@
+// StdLib
+#include <cstdint>
+
+// ArrayList
+#include "al/aligned_allocator.hpp"
+#include "al/array_list.hpp"
+#include "al/simd.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class List>
+void run_kind(bench::Reporter& reporter, const std::size_t size,
+              const char* container) {
+    const auto measure = [&](const char* operation, auto run) {
+        const bench::Case key{"aligned", operation, "float", container, size};
+        if (reporter.wants(key, size * sizeof(float))) {
+            reporter.measure(
+                key,
+                [size] {
+                    List list;
+                    list.resize(size);
+                    for (std::size_t i = 0; i < size; ++i) {
+                        list[i] = static_cast<float>(i % 1024);
+                    }
+                    return list;
+                },
+                run);
+        }
+    };
+
+    // Streaming through the buffer, where alignment spares the vector loop
+    // its peel.
+    measure("sum", [](const List& list) {
+        bench::do_not_optimize(al::simd::sum(list));
+    });
+    // Reads scattered over the whole buffer, where each one needs a TLB
+    // entry for its page.
+    measure("random_read", [size](const List& list) {
+        std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+        float sum = 0;
+        for (std::size_t i = 0; i < size / 8; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            sum += list[static_cast<std::size_t>(state >> 33U) % size];
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+const bench::RegisterSuite Registered("aligned", [](bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_kind<al::ArrayList<float>>(reporter, size, "al::ArrayList");
+        run_kind<al::AlignedArrayList<float>>(reporter, size,
+                                              "al::AlignedArrayList");
+        run_kind<al::HugePageArrayList<float>>(reporter, size,
+                                               "al::HugePageArrayList");
+    }
+});
+
+}  // namespace
@@ -0,0 +1,120 @@
+// StdLib
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/concurrent_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+constexpr std::size_t Batch = 64;
+
+struct LockedList {
+    static constexpr auto Name = "al::ArrayList+std::mutex";
+
+    void push_back(const std::uint64_t value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        list.push_back(value);
+    }
+
+    void append(const std::uint64_t* first, const std::uint64_t* last) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        list.push_back(first, last);
+    }
+
+    std::mutex mutex;
+    al::ArrayList<std::uint64_t> list;
+};
+
+struct Concurrent {
+    static constexpr auto Name = "al::ConcurrentArrayList";
+
+    void push_back(const std::uint64_t value) { list.push_back(value); }
+
+    void append(const std::uint64_t* first, const std::uint64_t* last) {
+        list.append(first, last);
+    }
+
+    al::ConcurrentArrayList<std::uint64_t> list;
+};
+
+/// Runs `produce(state, first, count)` on `threads` threads, splitting
+/// `size` values between them.
+template <class State, class Produce>
+void run_producers(State& state, const std::size_t size,
+                   const std::size_t threads, Produce produce) {
+    std::vector<std::thread> producers;
+    producers.reserve(threads);
+    for (std::size_t thread = 0; thread < threads; ++thread) {
+        const auto first = size * thread / threads;
+        const auto last = size * (thread + 1) / threads;
+        producers.emplace_back(
+            [&state, &produce, first, last] { produce(state, first, last); });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+template <class Kind>
+void run_kind(bench::Reporter& reporter, const std::size_t size,
+              const std::size_t threads) {
+    const auto container = std::string(Kind::Name) + "/" +
+                           std::to_string(threads) + "_threads";
+    const auto measure = [&](const char* operation, auto produce) {
+        const bench::Case key{"concurrent", operation, "uint64_t", container,
+                              size};
+        if (reporter.wants(key, 2 * size * sizeof(std::uint64_t))) {
+            reporter.measure(
+                key, [] { return std::make_unique<Kind>(); },
+                [&](std::unique_ptr<Kind>& state) {
+                    run_producers(*state, size, threads, produce);
+                });
+        }
+    };
+
+    measure("push_back", [](Kind& state, std::size_t first,
+                            const std::size_t last) {
+        for (; first < last; ++first) {
+            state.push_back(first);
+        }
+    });
+    measure("append_batch", [](Kind& state, std::size_t first,
+                               const std::size_t last) {
+        std::array<std::uint64_t, Batch> batch{};
+        while (first < last) {
+            const auto count = std::min(Batch, last - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                batch[i] = first + i;
+            }
+            state.append(batch.data(), batch.data() + count);
+            first += count;
+        }
+    });
+}
+
+const bench::RegisterSuite Registered(
+    "concurrent", [](bench::Reporter& reporter) {
+        // Thread start-up dominates below this.
+        constexpr std::size_t MinSize = 10'000;
+        for (const auto size : bench::sizes(reporter.options())) {
+            if (size < MinSize) {
+                continue;
+            }
+            for (const std::size_t threads : {1, 2, 4, 8, 16}) {
+                run_kind<LockedList>(reporter, size, threads);
+                run_kind<Concurrent>(reporter, size, threads);
+            }
+        }
+    });
+
+}  // namespace
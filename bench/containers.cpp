@@ -0,0 +1,265 @@
+// StdLib
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// ArrayList
+#include "al/array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+struct Pod64 {
+    std::array<std::uint64_t, 8> values;
+
+    friend auto operator<(const Pod64& self, const Pod64& that) -> bool {
+        return self.values[0] < that.values[0];
+    }
+};
+
+struct MoveOnly {
+    std::unique_ptr<std::uint64_t> value;
+
+    friend auto operator<(const MoveOnly& self, const MoveOnly& that) -> bool {
+        return *self.value < *that.value;
+    }
+};
+
+template <class Type>
+struct Element;
+
+template <>
+struct Element<int> {
+    static constexpr auto Name = "int";
+    static auto make(const std::size_t index) -> int {
+        return static_cast<int>(index);
+    }
+};
+
+template <>
+struct Element<Pod64> {
+    static constexpr auto Name = "pod64";
+    static auto make(const std::size_t index) -> Pod64 {
+        Pod64 value{};
+        value.values.fill(index);
+        return value;
+    }
+};
+
+template <>
+struct Element<std::string> {
+    static constexpr auto Name = "string";
+    static auto make(const std::size_t index) -> std::string {
+        // Long enough to defeat the small string optimization.
+        return "element number " + std::to_string(index) + " of the benchmark";
+    }
+};
+
+template <>
+struct Element<MoveOnly> {
+    static constexpr auto Name = "move_only";
+    static auto make(const std::size_t index) -> MoveOnly {
+        return MoveOnly{std::make_unique<std::uint64_t>(index)};
+    }
+};
+
+template <class Type>
+constexpr auto footprint() -> std::size_t {
+    if constexpr (std::is_same_v<Type, std::string>) {
+        return sizeof(Type) + 48;
+    } else if constexpr (std::is_same_v<Type, MoveOnly>) {
+        return sizeof(Type) + sizeof(std::uint64_t) + 16;
+    } else {
+        return sizeof(Type);
+    }
+}
+
+struct StdVector {
+    static constexpr auto Name = "std::vector";
+    template <class Type>
+    using Container = std::vector<Type>;
+};
+
+struct AlArrayList {
+    static constexpr auto Name = "al::ArrayList";
+    template <class Type>
+    using Container = al::ArrayList<Type>;
+};
+
+template <class Container>
+auto filled(const std::size_t size) -> Container {
+    using Type = typename Container::value_type;
+    Container container;
+    container.reserve(size);
+    for (std::size_t index = 0; index < size; ++index) {
+        container.push_back(Element<Type>::make(index));
+    }
+    return container;
+}
+
+template <class Container>
+auto shuffled(const std::size_t size) -> Container {
+    auto container = filled<Container>(size);
+    std::shuffle(container.begin(), container.end(), std::mt19937_64(42));
+    return container;
+}
+
+template <class Type, class Kind>
+void run_type(bench::Reporter& reporter, const std::size_t size) {
+    using Container = typename Kind::template Container<Type>;
+    constexpr bool Copyable = std::is_copy_constructible_v<Type>;
+
+    const auto bytes = size * footprint<Type>();
+    const auto key = [&](const char* operation) {
+        return bench::Case{"containers", operation, Element<Type>::Name,
+                           Kind::Name, size};
+    };
+    const auto measure = [&](const char* operation, const std::size_t copies,
+                             auto setup, auto run) {
+        if (reporter.wants(key(operation), bytes * copies)) {
+            reporter.measure(key(operation), setup, run);
+        }
+    };
+    const auto empty = [] { return Container(); };
+
+    measure("push_back", 1, empty, [size](Container& container) {
+        for (std::size_t index = 0; index < size; ++index) {
+            container.push_back(Element<Type>::make(index));
+        }
+    });
+    measure("emplace_back", 1, empty, [size](Container& container) {
+        for (std::size_t index = 0; index < size; ++index) {
+            container.emplace_back(Element<Type>::make(index));
+        }
+    });
+    measure("reserve_fill", 1, empty, [size](Container& container) {
+        container.reserve(size);
+        for (std::size_t index = 0; index < size; ++index) {
+            container.emplace_back(Element<Type>::make(index));
+        }
+    });
+    measure("resize", 1, empty,
+            [size](Container& container) { container.resize(size); });
+    measure(
+        "move", 2,
+        [size] {
+            return std::pair{filled<Container>(size), Container()};
+        },
+        [](auto& state) { state.second = std::move(state.first); });
+    // One element at a time away from the end moves the whole tail each
+    // time, so those cases stop where that is still affordable.
+    constexpr std::size_t MaxQuadraticSize = 10'000;
+    if (size <= MaxQuadraticSize) {
+        measure("insert_front", 1, empty, [size](Container& container) {
+            for (std::size_t index = 0; index < size; ++index) {
+                container.insert(container.begin(), Element<Type>::make(index));
+            }
+        });
+        measure("insert_middle", 1, empty, [size](Container& container) {
+            for (std::size_t index = 0; index < size; ++index) {
+                container.insert(container.begin() + container.size() / 2,
+                                 Element<Type>::make(index));
+            }
+        });
+    }
+    measure("insert_back", 1, empty, [size](Container& container) {
+        for (std::size_t index = 0; index < size; ++index) {
+            container.insert(container.end(), Element<Type>::make(index));
+        }
+    });
+    measure(
+        "erase", 1, [size] { return filled<Container>(size); },
+        [size](Container& container) {
+            container.erase(container.begin() + size / 4,
+                            container.begin() + size / 2);
+        });
+    measure(
+        "iterate", 1, [size] { return filled<Container>(size); },
+        [](Container& container) {
+            std::size_t count = 0;
+            for (auto& element : container) {
+                bench::do_not_optimize(element);
+                ++count;
+            }
+            bench::do_not_optimize(count);
+        });
+    measure(
+        "sort", 1, [size] { return shuffled<Container>(size); },
+        [](Container& container) {
+            std::sort(container.begin(), container.end());
+        });
+
+    if constexpr (Copyable) {
+        measure(
+            "range_construct", 2,
+            [size] {
+                return std::pair{filled<std::vector<Type>>(size),
+                                 Container()};
+            },
+            [](auto& state) {
+                state.second =
+                    Container(state.first.begin(), state.first.end());
+            });
+        measure(
+            "copy", 2,
+            [size] { return std::pair{filled<Container>(size), Container()}; },
+            [](auto& state) { state.second = state.first; });
+        // The per-frame pattern: the target already holds a previous copy.
+        measure(
+            "copy_assign_reuse", 2,
+            [size] {
+                return std::pair{filled<Container>(size),
+                                 filled<Container>(size)};
+            },
+            [](auto& state) { state.second = state.first; });
+        measure(
+            "assign_range_reuse", 2,
+            [size] {
+                return std::pair{filled<std::vector<Type>>(size),
+                                 filled<Container>(size)};
+            },
+            [](auto& state) {
+                state.second.assign(state.first.begin(), state.first.end());
+            });
+        measure(
+            "insert_range_middle", 2,
+            [size] {
+                return std::pair{filled<std::vector<Type>>(size),
+                                 filled<Container>(size)};
+            },
+            [size](auto& state) {
+                state.second.insert(state.second.begin() + size / 2,
+                                    state.first.begin(), state.first.end());
+            });
+        measure(
+            "assign_n_reuse", 1, [size] { return filled<Container>(size); },
+            [size](Container& container) {
+                container.assign(size, Element<Type>::make(size));
+            });
+    }
+}
+
+template <class Type>
+void run_element(bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_type<Type, StdVector>(reporter, size);
+        run_type<Type, AlArrayList>(reporter, size);
+    }
+}
+
+const bench::RegisterSuite Registered(
+    "containers", [](bench::Reporter& reporter) {
+        run_element<int>(reporter);
+        run_element<Pod64>(reporter);
+        run_element<std::string>(reporter);
+        run_element<MoveOnly>(reporter);
+    });
+
+}  // namespace
@@ -0,0 +1,45 @@
+// StdLib
+#include <cstddef>
+#include <memory>
+
+// ArrayList
+#include "al/array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class Policy>
+void run_policy(bench::Reporter& reporter, const std::size_t size,
+                const char* name) {
+    using List = al::ArrayList<int, std::allocator<int>, Policy>;
+    const bench::Case key{"growth", "push_back", "int", name, size};
+    if (not reporter.wants(key, 2 * size * sizeof(int))) {
+        return;
+    }
+    reporter.measure(
+        key, [] { return List(); },
+        [size](List& list) {
+            for (std::size_t index = 0; index < size; ++index) {
+                list.push_back(static_cast<int>(index));
+            }
+        });
+}
+
+const bench::RegisterSuite Registered("growth", [](bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_policy<al::GeometricGrowth<2, 1>>(reporter, size,
+                                              "al::GeometricGrowth<2, 1>");
+        run_policy<al::GeometricGrowth<3, 2>>(reporter, size,
+                                              "al::GeometricGrowth<3, 2>");
+        run_policy<al::GeometricGrowth<5, 4>>(reporter, size,
+                                              "al::GeometricGrowth<5, 4>");
+        run_policy<al::PageAlignedGrowth<>>(reporter, size,
+                                            "al::PageAlignedGrowth<>");
+        run_policy<al::JemallocSizeClassGrowth<>>(
+            reporter, size, "al::JemallocSizeClassGrowth<>");
+    }
+});
+
+}  // namespace
@@ -0,0 +1,154 @@
+#pragma once
+
+// StdLib
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+struct Options {
+    std::size_t min_size = 10;
+    std::size_t max_size = 100'000'000;
+    /// Cases whose containers would need more memory than this are skipped.
+    std::size_t max_bytes = std::size_t{1} << 30U;
+    int samples = 5;
+    std::string filter;
+};
+
+struct Case {
+    std::string suite;
+    std::string operation;
+    std::string type;
+    std::string container;
+    std::size_t size = 0;
+};
+
+struct Result {
+    Case key;
+    std::size_t iterations = 0;
+    double ns_min = 0;
+    double ns_median = 0;
+};
+
+template <class Type>
+inline void do_not_optimize(const Type& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink = nullptr;
+    sink = &value;
+#endif
+}
+
+class Reporter {
+   public:
+    explicit Reporter(Options options) : options_(std::move(options)) {}
+
+    [[nodiscard]] auto options() const noexcept -> const Options& {
+        return options_;
+    }
+
+    /// Whether a case of `size` elements taking `bytes` of memory should run.
+    [[nodiscard]] auto wants(const Case& key, const std::size_t bytes) const
+        -> bool {
+        if (key.size < options_.min_size or key.size > options_.max_size or
+            bytes > options_.max_bytes) {
+            return false;
+        }
+        if (options_.filter.empty()) {
+            return true;
+        }
+        const auto name = key.suite + "/" + key.operation + "/" + key.type +
+                          "/" + key.container;
+        return name.find(options_.filter) != std::string::npos;
+    }
+
+    /// Times `run(state)` on fresh states made by `setup()` outside the timed
+    /// region, batching small cases so each sample runs long enough to time.
+    template <class Setup, class Run>
+    void measure(const Case& key, Setup setup, Run run) {
+        constexpr std::size_t ElementsPerSample = 1'000'000;
+        constexpr std::size_t MaxIterations = 10'000;
+        const auto iterations = std::min(
+            MaxIterations,
+            std::max<std::size_t>(1, ElementsPerSample / std::max<std::size_t>(
+                                                             key.size, 1)));
+
+        std::vector<double> samples;
+        for (int sample = 0; sample < options_.samples; ++sample) {
+            std::vector<decltype(setup())> states;
+            states.reserve(iterations);
+            for (std::size_t i = 0; i < iterations; ++i) {
+                states.push_back(setup());
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            for (auto& state : states) {
+                run(state);
+                do_not_optimize(state);
+            }
+            const auto stop = std::chrono::steady_clock::now();
+
+            samples.push_back(
+                std::chrono::duration<double, std::nano>(stop - start)
+                    .count() /
+                static_cast<double>(iterations));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        results_.push_back(Result{key, iterations, samples.front(),
+                                  samples[samples.size() / 2]});
+    }
+
+    void write_json(std::ostream& out) const {
+        out << "{\n  \"results\": [";
+        for (std::size_t index = 0; index < results_.size(); ++index) {
+            const auto& result = results_[index];
+            out << (index == 0 ? "\n" : ",\n") << "    {\"suite\": \""
+                << result.key.suite << "\", \"operation\": \""
+                << result.key.operation << "\", \"type\": \""
+                << result.key.type << "\", \"container\": \""
+                << result.key.container << "\", \"size\": " << result.key.size
+                << ", \"iterations\": " << result.iterations
+                << ", \"ns_min\": " << result.ns_min
+                << ", \"ns_median\": " << result.ns_median << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+   private:
+    Options options_;
+    std::vector<Result> results_;
+};
+
+using Suite = std::function<void(Reporter&)>;
+
+inline auto suites() -> std::vector<std::pair<std::string, Suite>>& {
+    static std::vector<std::pair<std::string, Suite>> registered;
+    return registered;
+}
+
+struct RegisterSuite {
+    RegisterSuite(std::string name, Suite suite) {
+        suites().emplace_back(std::move(name), std::move(suite));
+    }
+};
+
+/// Powers of ten from 10 up to the configured maximum.
+inline auto sizes(const Options& options) -> std::vector<std::size_t> {
+    std::vector<std::size_t> result;
+    for (std::size_t size = 10; size <= options.max_size; size *= 10) {
+        if (size >= options.min_size) {
+            result.push_back(size);
+        }
+    }
+    return result;
+}
+
+}  // namespace bench
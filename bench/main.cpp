@@ -0,0 +1,65 @@
+// StdLib
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+void usage(const char* program) {
+    std::cerr << "usage: " << program
+              << " [--min-size N] [--max-size N] [--max-bytes N]"
+                 " [--samples N] [--filter TEXT] [--out FILE]\n";
+}
+
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+    bench::Options options;
+    std::string out_path;
+
+    for (int index = 1; index < argc; ++index) {
+        const auto has_value = index + 1 < argc;
+        const auto matches = [&](const char* flag) {
+            return std::strcmp(argv[index], flag) == 0 and has_value;
+        };
+        if (matches("--min-size")) {
+            options.min_size = std::strtoull(argv[++index], nullptr, 10);
+        } else if (matches("--max-size")) {
+            options.max_size = std::strtoull(argv[++index], nullptr, 10);
+        } else if (matches("--max-bytes")) {
+            options.max_bytes = std::strtoull(argv[++index], nullptr, 10);
+        } else if (matches("--samples")) {
+            options.samples = std::atoi(argv[++index]);
+        } else if (matches("--filter")) {
+            options.filter = argv[++index];
+        } else if (matches("--out")) {
+            out_path = argv[++index];
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.samples < 1) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bench::Reporter reporter(options);
+    for (const auto& [name, suite] : bench::suites()) {
+        std::cerr << "Running " << name << "\n";
+        suite(reporter);
+    }
+
+    if (out_path.empty()) {
+        reporter.write_json(std::cout);
+    } else {
+        std::ofstream out(out_path);
+        reporter.write_json(out);
+    }
+    return EXIT_SUCCESS;
+}
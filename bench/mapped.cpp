@@ -0,0 +1,112 @@
+#if defined(__unix__) || defined(__APPLE__)
+
+// StdLib
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <numeric>
+#include <string>
+
+// POSIX
+#include <unistd.h>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/mapped_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+using Mapped = al::MappedArrayList<std::uint64_t>;
+
+auto temp_path(const char* name) -> std::string {
+    return (std::filesystem::temp_directory_path() /
+            ("al-bench-" + std::to_string(::getpid()) + "-" + name))
+        .string();
+}
+
+/// The usual way back: read a saved file into a fresh ArrayList.
+auto read_list(const std::string& path, const std::size_t size)
+    -> al::ArrayList<std::uint64_t> {
+    al::ArrayList<std::uint64_t> list;
+    list.append_with(size, [&path](std::uint64_t* tail, std::size_t room) {
+        std::FILE* const file = std::fopen(path.c_str(), "rb");
+        const auto read = std::fread(tail, sizeof(*tail), room, file);
+        std::fclose(file);
+        return read;
+    });
+    return list;
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size) {
+    const auto measure = [&](const char* operation, const char* container,
+                             auto run) {
+        const bench::Case key{"mapped", operation, "uint64_t", container,
+                              size};
+        if (reporter.wants(key, 2 * size * sizeof(std::uint64_t))) {
+            reporter.measure(key, [] { return 0; }, [&run](int&) { run(); });
+        }
+    };
+
+    const auto raw = temp_path("raw");
+    const auto mapped = temp_path("mapped");
+    {
+        Mapped list(mapped);
+        list.resize(size);
+        std::iota(list.begin(), list.end(), std::uint64_t{0});
+        std::FILE* const file = std::fopen(raw.c_str(), "wb");
+        std::fwrite(list.data(), sizeof(std::uint64_t), size, file);
+        std::fclose(file);
+    }
+
+    // Getting the list back, then reading all of it.
+    measure("reopen", "al::ArrayList", [&raw, size] {
+        bench::do_not_optimize(read_list(raw, size).data());
+    });
+    measure("reopen", "al::MappedArrayList", [&mapped] {
+        const Mapped list(mapped);
+        bench::do_not_optimize(list.data());
+    });
+    measure("reopen+scan", "al::ArrayList", [&raw, size] {
+        const auto list = read_list(raw, size);
+        bench::do_not_optimize(
+            std::accumulate(list.begin(), list.end(), std::uint64_t{0}));
+    });
+    measure("reopen+scan", "al::MappedArrayList", [&mapped] {
+        Mapped list(mapped);
+        list.advise(al::MappedAdvice::Sequential);
+        bench::do_not_optimize(
+            std::accumulate(list.begin(), list.end(), std::uint64_t{0}));
+    });
+
+    measure("push_back", "al::ArrayList", [size] {
+        al::ArrayList<std::uint64_t> list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.push_back(i);
+        }
+        bench::do_not_optimize(list.data());
+    });
+    measure("push_back", "al::MappedArrayList", [&mapped, size] {
+        Mapped list(mapped);
+        list.clear();
+        for (std::size_t i = 0; i < size; ++i) {
+            list.push_back(i);
+        }
+        bench::do_not_optimize(list.data());
+    });
+
+    std::filesystem::remove(raw);
+    std::filesystem::remove(mapped);
+}
+
+const bench::RegisterSuite Registered("mapped", [](bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_size(reporter, size);
+    }
+});
+
+}  // namespace
+
+#endif
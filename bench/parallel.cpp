@@ -0,0 +1,162 @@
+// StdLib
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__cpp_lib_parallel_algorithm)
+#include <execution>
+#endif
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/parallel.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+using List = al::ArrayList<std::uint32_t>;
+
+auto keep(const std::uint32_t value) -> bool { return value % 3 == 0; }
+
+auto twice(const std::uint32_t value) -> std::uint64_t {
+    return std::uint64_t{value} * 2;
+}
+
+/// Thread counts from one up to every core, doubling.
+auto thread_counts() -> std::vector<std::size_t> {
+    const std::size_t cores =
+        std::max(1U, std::thread::hardware_concurrency());
+    std::vector<std::size_t> result;
+    for (std::size_t threads = 1; threads < cores; threads *= 2) {
+        result.push_back(threads);
+    }
+    result.push_back(cores);
+    return result;
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size) {
+    List shuffled;
+    shuffled.resize(size);
+    std::iota(shuffled.begin(), shuffled.end(), std::uint32_t{0});
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(42));
+
+    const auto measure = [&](const char* operation,
+                             const std::string& container,
+                             const std::size_t copies, auto setup, auto run) {
+        const bench::Case key{"parallel", operation, "uint32_t", container,
+                              size};
+        if (reporter.wants(key, copies * size * sizeof(std::uint64_t))) {
+            reporter.measure(key, setup, run);
+        }
+    };
+    const auto shared = [&shuffled] { return &shuffled; };
+    const auto copy = [&shuffled] { return List(shuffled); };
+
+    // Serial STL algorithms are the baseline.
+    measure("for_each", "std", 1, copy, [](List& list) {
+        std::for_each(list.begin(), list.end(),
+                      [](std::uint32_t& value) { value = value * 3 + 1; });
+    });
+    measure("transform", "std", 2, shared, [size](const List* list) {
+        al::ArrayList<std::uint64_t> output;
+        output.reserve(size);
+        std::transform(list->begin(), list->end(), std::back_inserter(output),
+                       twice);
+        bench::do_not_optimize(output.data());
+    });
+    measure("reduce", "std", 1, shared, [](const List* list) {
+        bench::do_not_optimize(std::accumulate(list->begin(), list->end(),
+                                               std::uint64_t{0}));
+    });
+    measure("sort", "std", 1, copy,
+            [](List& list) { std::sort(list.begin(), list.end()); });
+    measure("copy_if", "std", 2, shared, [size](const List* list) {
+        List output;
+        output.reserve(size);
+        std::copy_if(list->begin(), list->end(), std::back_inserter(output),
+                     keep);
+        bench::do_not_optimize(output.data());
+    });
+
+#if defined(__cpp_lib_parallel_algorithm)
+    // Only parallel when the standard library has a backend such as TBB.
+    const auto par = std::execution::par;
+    measure("for_each", "std::execution::par", 1, copy, [par](List& list) {
+        std::for_each(par, list.begin(), list.end(),
+                      [](std::uint32_t& value) { value = value * 3 + 1; });
+    });
+    measure("transform", "std::execution::par", 2, shared,
+            [par, size](const List* list) {
+                al::ArrayList<std::uint64_t> output;
+                output.resize_for_overwrite(size);
+                std::transform(par, list->begin(), list->end(), output.begin(),
+                               twice);
+                bench::do_not_optimize(output.data());
+            });
+    measure("reduce", "std::execution::par", 1, shared,
+            [par](const List* list) {
+                bench::do_not_optimize(std::reduce(
+                    par, list->begin(), list->end(), std::uint64_t{0}));
+            });
+    measure("sort", "std::execution::par", 1, copy, [par](List& list) {
+        std::sort(par, list.begin(), list.end());
+    });
+    measure("copy_if", "std::execution::par", 2, shared,
+            [par, size](const List* list) {
+                List output;
+                output.resize_for_overwrite(size);
+                const auto end = std::copy_if(par, list->begin(), list->end(),
+                                              output.begin(), keep);
+                bench::do_not_optimize(end);
+            });
+#endif
+
+    for (const auto threads : thread_counts()) {
+        al::parallel::ThreadPool pool(threads);
+        const auto name = "al::parallel/" + std::to_string(threads);
+        measure("for_each", name, 1, copy, [&pool](List& list) {
+            al::parallel::for_each(
+                list, [](std::uint32_t& value) { value = value * 3 + 1; },
+                pool);
+        });
+        measure("transform", name, 2, shared, [&pool, size](const List* list) {
+            al::ArrayList<std::uint64_t> output;
+            output.reserve(size);
+            al::parallel::transform(*list, output, twice, pool);
+            bench::do_not_optimize(output.data());
+        });
+        measure("reduce", name, 1, shared, [&pool](const List* list) {
+            bench::do_not_optimize(al::parallel::reduce(
+                *list, std::uint64_t{0}, std::plus<std::uint64_t>(), pool));
+        });
+        measure("sort", name, 1, copy, [&pool](List& list) {
+            al::parallel::sort(list, std::less<std::uint32_t>(), pool);
+        });
+        measure("copy_if", name, 2, shared, [&pool, size](const List* list) {
+            List output;
+            output.reserve(size);
+            al::parallel::copy_if(*list, output, keep, pool);
+            bench::do_not_optimize(output.data());
+        });
+    }
+}
+
+const bench::RegisterSuite Registered(
+    "parallel", [](bench::Reporter& reporter) {
+        // Below this the pool is all overhead.
+        constexpr std::size_t MinSize = 10'000;
+        for (const auto size : bench::sizes(reporter.options())) {
+            if (size >= MinSize) {
+                run_size(reporter, size);
+            }
+        }
+    });
+
+}  // namespace
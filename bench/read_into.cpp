@@ -0,0 +1,128 @@
+// StdLib
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/read_into.hpp"
+
+// Bench
+#include "harness.hpp"
+
+#if AL_HAS_POSIX_IO
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+auto temp_path(const char* name) -> std::string {
+    return (std::filesystem::temp_directory_path() /
+            (std::string("al-bench-read-into-") + name))
+        .string();
+}
+
+auto parse_lines(al::ArrayList<long>& list, const char* const data,
+                 const std::size_t size, const bool last) -> std::size_t {
+    std::size_t used = 0;
+    for (std::size_t end = 0; end < size; ++end) {
+        if (data[end] == '\n') {
+            list.push_back(std::strtol(data + used, nullptr, 10));
+            used = end + 1;
+        }
+    }
+    if (last and used < size) {
+        list.push_back(std::strtol(std::string(data + used, size - used)
+                                       .c_str(),
+                                   nullptr, 10));
+        used = size;
+    }
+    return used;
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size) {
+    const auto measure = [&](const char* operation, const char* type,
+                             const char* container, const std::size_t bytes,
+                             auto run) {
+        const bench::Case key{"read_into", operation, type, container, size};
+        if (reporter.wants(key, 2 * bytes)) {
+            reporter.measure(key, [] { return 0; }, [&run](int&) { run(); });
+        }
+    };
+
+    // `size` bytes of text, one number per line.
+    const auto text = temp_path("text");
+    {
+        std::ofstream out(text, std::ios::binary);
+        std::size_t written = 0;
+        for (std::size_t i = 0; written < size; ++i) {
+            auto line = std::to_string(i * 7919 % 1000003) + '\n';
+            if (written + line.size() > size) {
+                line.resize(size - written);
+            }
+            out << line;
+            written += line.size();
+        }
+    }
+
+    measure("load", "char", "istreambuf_iterator", size, [&text] {
+        std::ifstream in(text, std::ios::binary);
+        const al::ArrayList<char> list((std::istreambuf_iterator<char>(in)),
+                                       std::istreambuf_iterator<char>());
+        bench::do_not_optimize(list.data());
+    });
+    measure("load", "char", "al::read_into ifstream", size, [&text] {
+        std::ifstream in(text, std::ios::binary);
+        al::ArrayList<char> list;
+        al::read_into(list, in);
+        bench::do_not_optimize(list.data());
+    });
+#if AL_HAS_POSIX_IO
+    measure("load", "char", "al::read_into fd", size, [&text] {
+        const int fd = ::open(text.c_str(), O_RDONLY);
+        al::ArrayList<char> list;
+        al::read_into(list, al::FileDescriptor{fd});
+        ::close(fd);
+        bench::do_not_optimize(list.data());
+    });
+#endif
+
+    measure("parse", "long", "getline", size, [&text] {
+        std::ifstream in(text, std::ios::binary);
+        al::ArrayList<long> list;
+        std::string line;
+        while (std::getline(in, line)) {
+            list.push_back(std::strtol(line.c_str(), nullptr, 10));
+        }
+        bench::do_not_optimize(list.data());
+    });
+    measure("parse", "long", "al::read_into ifstream", size, [&text] {
+        std::ifstream in(text, std::ios::binary);
+        al::ArrayList<long> list;
+        al::read_into(list, in, parse_lines);
+        bench::do_not_optimize(list.data());
+    });
+    measure("parse", "long", "al::read_into background", size, [&text] {
+        std::ifstream in(text, std::ios::binary);
+        al::ReadOptions options;
+        options.background = true;
+        al::ArrayList<long> list;
+        al::read_into(list, in, parse_lines, options);
+        bench::do_not_optimize(list.data());
+    });
+
+    std::filesystem::remove(text);
+}
+
+const bench::RegisterSuite Registered(
+    "read_into", [](bench::Reporter& reporter) {
+        for (const auto size : bench::sizes(reporter.options())) {
+            run_size(reporter, size);
+        }
+    });
+
+}  // namespace
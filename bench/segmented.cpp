@@ -0,0 +1,101 @@
+// StdLib
+#include <cstdint>
+#include <deque>
+#include <numeric>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/segmented_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class List>
+void run_kind(bench::Reporter& reporter, const std::size_t size,
+              const char* container) {
+    const auto measure = [&](const char* operation, auto setup, auto run) {
+        const bench::Case key{"segmented", operation, "uint64_t", container,
+                              size};
+        // Growing a contiguous list briefly holds the old and new buffers.
+        if (reporter.wants(key, 3 * size * sizeof(std::uint64_t))) {
+            reporter.measure(key, setup, run);
+        }
+    };
+    const auto filled = [size] {
+        List list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.push_back(i);
+        }
+        return list;
+    };
+
+    measure(
+        "push_back", [] { return List(); },
+        [size](List& list) {
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_back(i);
+            }
+        });
+    measure("iterate", filled, [](const List& list) {
+        bench::do_not_optimize(
+            std::accumulate(list.begin(), list.end(), std::uint64_t{0}));
+    });
+    measure("index", filled, [size](const List& list) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < size; i += 7) {
+            sum += list[i];
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+/// What only the segmented list offers: walking it a segment at a time,
+/// and turning it into a contiguous list.
+void run_segmented(bench::Reporter& reporter, const std::size_t size) {
+    using List = al::SegmentedArrayList<std::uint64_t>;
+    const auto measure = [&](const char* operation, auto run) {
+        const bench::Case key{"segmented", operation, "uint64_t",
+                              "al::SegmentedArrayList", size};
+        if (reporter.wants(key, 2 * size * sizeof(std::uint64_t))) {
+            reporter.measure(
+                key,
+                [size] {
+                    List list;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        list.push_back(i);
+                    }
+                    return list;
+                },
+                run);
+        }
+    };
+
+    measure("iterate_segments", [](const List& list) {
+        std::uint64_t sum = 0;
+        list.for_each_segment(
+            [&sum](const std::uint64_t* first, const std::size_t count) {
+                sum = std::accumulate(first, first + count, sum);
+            });
+        bench::do_not_optimize(sum);
+    });
+    measure("freeze", [](List& list) {
+        bench::do_not_optimize(list.freeze().data());
+    });
+}
+
+const bench::RegisterSuite Registered(
+    "segmented", [](bench::Reporter& reporter) {
+        for (const auto size : bench::sizes(reporter.options())) {
+            run_kind<al::ArrayList<std::uint64_t>>(reporter, size,
+                                                   "al::ArrayList");
+            run_kind<std::deque<std::uint64_t>>(reporter, size, "std::deque");
+            run_kind<al::SegmentedArrayList<std::uint64_t>>(
+                reporter, size, "al::SegmentedArrayList");
+
+            run_segmented(reporter, size);
+        }
+    });
+
+}  // namespace
@@ -0,0 +1,170 @@
+// StdLib
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/serialize.hpp"
+
+// Bench
+#include "harness.hpp"
+
+#if AL_HAS_POSIX_IO
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct Record {
+    double x, y, z;
+    std::uint64_t id;
+};
+
+auto temp_path(const char* name) -> std::string {
+    return (std::filesystem::temp_directory_path() /
+            (std::string("al-bench-serialize-") + name))
+        .string();
+}
+
+/// The usual way: one stream call per element, or per field.
+void write_each(const std::string& path, const al::ArrayList<Record>& list) {
+    std::ofstream out(path, std::ios::binary);
+    const auto size = static_cast<std::uint64_t>(list.size());
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (const auto& record : list) {
+        out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+}
+
+auto read_each(const std::string& path) -> al::ArrayList<Record> {
+    std::ifstream in(path, std::ios::binary);
+    std::uint64_t size = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    al::ArrayList<Record> list;
+    list.reserve(static_cast<std::size_t>(size));
+    Record record{};
+    for (std::uint64_t i = 0; i < size; ++i) {
+        in.read(reinterpret_cast<char*>(&record), sizeof(record));
+        list.push_back(record);
+    }
+    return list;
+}
+
+void write_each(const std::string& path,
+                const al::ArrayList<std::string>& list) {
+    std::ofstream out(path, std::ios::binary);
+    const auto size = static_cast<std::uint64_t>(list.size());
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (const auto& value : list) {
+        const auto length = static_cast<std::uint64_t>(value.size());
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+}
+
+auto read_strings(const std::string& path) -> al::ArrayList<std::string> {
+    std::ifstream in(path, std::ios::binary);
+    std::uint64_t size = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    al::ArrayList<std::string> list;
+    list.reserve(static_cast<std::size_t>(size));
+    for (std::uint64_t i = 0; i < size; ++i) {
+        std::uint64_t length = 0;
+        in.read(reinterpret_cast<char*>(&length), sizeof(length));
+        std::string value(static_cast<std::size_t>(length), '\0');
+        in.read(&value[0], static_cast<std::streamsize>(length));
+        list.push_back(std::move(value));
+    }
+    return list;
+}
+
+template <class Type>
+void run_type(bench::Reporter& reporter, const char* type_name,
+              const al::ArrayList<Type>& list, const std::size_t bytes) {
+    const auto size = list.size();
+    const auto measure = [&](const char* operation, const char* container,
+                             auto run) {
+        const bench::Case key{"serialize", operation, type_name, container,
+                              size};
+        if (reporter.wants(key, 2 * bytes)) {
+            reporter.measure(key, [] { return 0; }, [&run](int&) { run(); });
+        }
+    };
+
+    const auto each = temp_path("each");
+    const auto whole = temp_path("whole");
+    write_each(each, list);
+    {
+        std::ofstream out(whole, std::ios::binary);
+        al::serialize(out, list);
+    }
+
+    measure("write", "per-element ofstream",
+            [&each, &list] { write_each(each, list); });
+    measure("write", "al::serialize ofstream", [&whole, &list] {
+        std::ofstream out(whole, std::ios::binary);
+        al::serialize(out, list);
+    });
+#if AL_HAS_POSIX_IO
+    measure("write", "al::serialize fd", [&whole, &list] {
+        const int fd = ::open(whole.c_str(), O_WRONLY | O_TRUNC);
+        al::serialize(al::FileDescriptor{fd}, list);
+        ::close(fd);
+    });
+#endif
+
+    measure("read", "per-element ifstream", [&each] {
+        if constexpr (std::is_same<Type, std::string>::value) {
+            bench::do_not_optimize(read_strings(each).data());
+        } else {
+            bench::do_not_optimize(read_each(each).data());
+        }
+    });
+    measure("read", "al::deserialize ifstream", [&whole] {
+        std::ifstream in(whole, std::ios::binary);
+        al::ArrayList<Type> copy;
+        al::deserialize(in, copy);
+        bench::do_not_optimize(copy.data());
+    });
+#if AL_HAS_POSIX_IO
+    measure("read", "al::deserialize fd", [&whole] {
+        const int fd = ::open(whole.c_str(), O_RDONLY);
+        al::ArrayList<Type> copy;
+        al::deserialize(al::FileDescriptor{fd}, copy);
+        ::close(fd);
+        bench::do_not_optimize(copy.data());
+    });
+#endif
+
+    std::filesystem::remove(each);
+    std::filesystem::remove(whole);
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size) {
+    al::ArrayList<Record> records;
+    al::ArrayList<std::string> strings;
+    std::size_t string_bytes = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto value = static_cast<double>(i);
+        records.push_back({value, value * 2, value * 3, i});
+        strings.push_back(std::string(i % 24, 's') + std::to_string(i));
+        string_bytes += strings.back().size();
+    }
+    run_type(reporter, "Record32", records, size * sizeof(Record));
+    run_type(reporter, "std::string", strings, string_bytes);
+}
+
+const bench::RegisterSuite Registered(
+    "serialize", [](bench::Reporter& reporter) {
+        for (const auto size : bench::sizes(reporter.options())) {
+            run_size(reporter, size);
+        }
+    });
+
+}  // namespace
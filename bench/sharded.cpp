@@ -0,0 +1,91 @@
+// StdLib
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/parallel.hpp"
+#include "al/sharded_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+using Shard = al::ArrayList<std::uint64_t>;
+
+/// Splits `size` values between `shards` shards, as producers would leave
+/// them.
+template <class Emplace>
+void fill_shards(const std::size_t size, const std::size_t shards,
+                 Emplace shard) {
+    for (std::size_t index = 0; index < shards; ++index) {
+        auto& list = shard(index);
+        for (auto value = size * index / shards;
+             value < size * (index + 1) / shards; ++value) {
+            list.push_back(value);
+        }
+    }
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size,
+              const std::size_t shards, al::parallel::ThreadPool& pool) {
+    const auto measure = [&](const char* container, auto setup, auto run) {
+        const bench::Case key{"sharded",
+                              "merge/" + std::to_string(shards) + "_shards",
+                              "uint64_t", container, size};
+        if (reporter.wants(key, 2 * size * sizeof(std::uint64_t))) {
+            reporter.measure(key, setup, run);
+        }
+    };
+
+    // What callers did before: concatenate with a range push_back each.
+    measure(
+        "push_back(first, last)",
+        [size, shards] {
+            al::ArrayList<Shard> lists;
+            lists.resize(shards);
+            fill_shards(size, shards,
+                        [&lists](const std::size_t index) -> Shard& {
+                            return lists[index];
+                        });
+            return lists;
+        },
+        [](al::ArrayList<Shard>& lists) {
+            Shard merged;
+            for (const auto& list : lists) {
+                merged.push_back(list.begin(), list.end());
+            }
+            bench::do_not_optimize(merged.data());
+        });
+
+    measure(
+        "al::ShardedArrayList",
+        [size, shards] {
+            auto sharded =
+                std::make_unique<al::ShardedArrayList<std::uint64_t>>();
+            fill_shards(size, shards,
+                        [&sharded](const std::size_t index) -> Shard& {
+                            return sharded->shard(index);
+                        });
+            return sharded;
+        },
+        [&pool](std::unique_ptr<al::ShardedArrayList<std::uint64_t>>& sharded) {
+            const auto merged = sharded->merge(pool);
+            bench::do_not_optimize(merged.data());
+        });
+}
+
+const bench::RegisterSuite Registered("sharded", [](bench::Reporter& reporter) {
+    auto& pool = al::parallel::default_pool();
+    for (const auto size : bench::sizes(reporter.options())) {
+        for (const std::size_t shards : {4, 16, 64}) {
+            if (size >= shards) {
+                run_size(reporter, size, shards, pool);
+            }
+        }
+    }
+});
+
+}  // namespace
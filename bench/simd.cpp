@@ -0,0 +1,140 @@
+// StdLib
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/simd.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class Type>
+struct Element;
+
+template <>
+struct Element<std::uint32_t> {
+    static constexpr auto Name = "uint32_t";
+};
+
+template <>
+struct Element<float> {
+    static constexpr auto Name = "float";
+};
+
+template <>
+struct Element<char> {
+    static constexpr auto Name = "char";
+};
+
+constexpr auto isa_name(const al::simd::Isa isa) -> const char* {
+    switch (isa) {
+        case al::simd::Isa::Scalar:
+            return "al::simd/scalar";
+        case al::simd::Isa::Sse2:
+            return "al::simd/sse2";
+        case al::simd::Isa::Avx2:
+            return "al::simd/avx2";
+        case al::simd::Isa::Avx512:
+            return "al::simd/avx512";
+    }
+    return "";
+}
+
+template <class Type>
+void run_type(bench::Reporter& reporter, const std::size_t size) {
+    using List = al::ArrayList<Type>;
+
+    // Values cycle below 100, so searching for 101 scans the whole list.
+    List list;
+    list.reserve(size);
+    for (std::size_t index = 0; index < size; ++index) {
+        list.push_back(static_cast<Type>(index % 100));
+    }
+    const List copy = list;
+    const auto missing = static_cast<Type>(101);
+
+    const auto measure = [&](const char* operation, const char* container,
+                             auto run) {
+        const bench::Case key{"simd", operation, Element<Type>::Name,
+                              container, size};
+        if (reporter.wants(key, 2 * size * sizeof(Type))) {
+            reporter.measure(
+                key, [&list] { return &list; },
+                [&run](const List* state) {
+                    bench::do_not_optimize(run(*state));
+                });
+        }
+    };
+
+    // The scalar STL algorithms are the baseline.
+    measure("find", "std", [&](const List& self) {
+        return std::find(self.begin(), self.end(), missing);
+    });
+    measure("count", "std", [&](const List& self) {
+        return std::count(self.begin(), self.end(), missing);
+    });
+    measure("min", "std", [](const List& self) {
+        return *std::min_element(self.begin(), self.end());
+    });
+    measure("max", "std", [](const List& self) {
+        return *std::max_element(self.begin(), self.end());
+    });
+    measure("sum", "std", [](const List& self) {
+        return std::accumulate(self.begin(), self.end(), Type());
+    });
+    measure("equal", "std", [&](const List& self) {
+        return std::equal(self.begin(), self.end(), copy.begin(), copy.end());
+    });
+    measure("compare", "std", [&](const List& self) {
+        return std::lexicographical_compare(self.begin(), self.end(),
+                                            copy.begin(), copy.end());
+    });
+
+    for (const auto isa : {al::simd::Isa::Scalar, al::simd::Isa::Sse2,
+                           al::simd::Isa::Avx2, al::simd::Isa::Avx512}) {
+        if (isa > al::simd::detected_isa()) {
+            break;
+        }
+        al::simd::limit_isa(isa);
+        const auto* const name = isa_name(isa);
+        measure("find", name, [&](const List& self) {
+            return al::simd::find(self, missing);
+        });
+        measure("count", name, [&](const List& self) {
+            return al::simd::count(self, missing);
+        });
+        measure("min", name,
+                [](const List& self) { return al::simd::min(self); });
+        measure("max", name,
+                [](const List& self) { return al::simd::max(self); });
+        measure("sum", name,
+                [](const List& self) { return al::simd::sum(self); });
+        measure("equal", name, [&](const List& self) {
+            return al::simd::equal(self, copy);
+        });
+        measure("compare", name, [&](const List& self) {
+            return al::simd::compare(self, copy);
+        });
+    }
+    al::simd::limit_isa(al::simd::Isa::Avx512);
+}
+
+template <class Type>
+void run_element(bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_type<Type>(reporter, size);
+    }
+}
+
+const bench::RegisterSuite Registered("simd", [](bench::Reporter& reporter) {
+    run_element<std::uint32_t>(reporter);
+    run_element<float>(reporter);
+    run_element<char>(reporter);
+});
+
+}  // namespace
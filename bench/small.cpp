@@ -0,0 +1,38 @@
+// StdLib
+#include <cstddef>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/small_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class List>
+void run_list(bench::Reporter& reporter, const std::size_t size,
+              const char* name) {
+    const bench::Case key{"small", "push_back", "int", name, size};
+    if (not reporter.wants(key, size * sizeof(int))) {
+        return;
+    }
+    reporter.measure(
+        key, [] { return List(); },
+        [size](List& list) {
+            for (std::size_t index = 0; index < size; ++index) {
+                list.push_back(static_cast<int>(index));
+            }
+        });
+}
+
+const bench::RegisterSuite Registered("small", [](bench::Reporter& reporter) {
+    // Lists that fit the inline buffer, and lists that outgrow it.
+    for (const std::size_t size : {10, 100}) {
+        run_list<al::ArrayList<int>>(reporter, size, "al::ArrayList");
+        run_list<al::SmallArrayList<int, 16>>(reporter, size,
+                                              "al::SmallArrayList<16>");
+    }
+});
+
+}  // namespace
@@ -0,0 +1,114 @@
+// StdLib
+#include <cstdint>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/soa_array_list.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+/// Nine fields, of which the scans below touch one or two.
+struct Particle {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass;
+    std::uint32_t id;
+    std::uint32_t flags;
+};
+
+using Structs = al::ArrayList<Particle>;
+using Columns = al::SoAArrayList<float, float, float, float, float, float,
+                                 float, std::uint32_t, std::uint32_t>;
+
+enum Field : std::size_t { X, Y, Z, Vx, Vy, Vz, Mass, Id, Flags };
+
+auto make(const std::size_t index) -> Particle {
+    const auto value = static_cast<float>(index % 1024);
+    return Particle{value, value, value, 1, 2, 3, 1,
+                    static_cast<std::uint32_t>(index), 0};
+}
+
+void run_size(bench::Reporter& reporter, const std::size_t size) {
+    const auto measure = [&](const char* operation, const char* container,
+                             auto setup, auto run) {
+        const bench::Case key{"soa", operation, "particle", container, size};
+        if (reporter.wants(key, size * sizeof(Particle))) {
+            reporter.measure(key, setup, run);
+        }
+    };
+
+    const auto structs = [size] {
+        Structs list;
+        list.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            list.push_back(make(i));
+        }
+        return list;
+    };
+    const auto columns = [size] {
+        Columns list;
+        list.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto p = make(i);
+            list.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id,
+                              p.flags);
+        }
+        return list;
+    };
+
+    // One field: a reduction over positions.
+    measure("sum_x", "al::ArrayList<struct>", structs, [](const Structs& list) {
+        float sum = 0;
+        for (const auto& particle : list) {
+            sum += particle.x;
+        }
+        bench::do_not_optimize(sum);
+    });
+    measure("sum_x", "al::SoAArrayList", columns, [](const Columns& list) {
+        float sum = 0;
+        for (const auto x : list.column<X>()) {
+            sum += x;
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    // Two fields: integrate positions.
+    measure("x+=vx", "al::ArrayList<struct>", structs, [](Structs& list) {
+        for (auto& particle : list) {
+            particle.x += particle.vx;
+        }
+    });
+    measure("x+=vx", "al::SoAArrayList", columns, [](Columns& list) {
+        const auto x = list.column<X>();
+        const auto vx = list.column<Vx>();
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            x[i] += vx[i];
+        }
+    });
+
+    measure("push_back", "al::ArrayList<struct>", [] { return Structs(); },
+            [size](Structs& list) {
+                for (std::size_t i = 0; i < size; ++i) {
+                    list.push_back(make(i));
+                }
+            });
+    measure("push_back", "al::SoAArrayList", [] { return Columns(); },
+            [size](Columns& list) {
+                for (std::size_t i = 0; i < size; ++i) {
+                    const auto p = make(i);
+                    list.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass,
+                                      p.id, p.flags);
+                }
+            });
+}
+
+const bench::RegisterSuite Registered("soa", [](bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        run_size(reporter, size);
+    }
+});
+
+}  // namespace
@@ -0,0 +1,65 @@
+#if defined(__unix__) || defined(__APPLE__)
+
+// StdLib
+#include <cstdint>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/virtual_memory_allocator.hpp"
+
+// Bench
+#include "harness.hpp"
+
+namespace {
+
+template <class List, class Make>
+void run_kind(bench::Reporter& reporter, const std::size_t size,
+              const char* type, const char* container, Make make) {
+    const bench::Case key{"virtual", "push_back", type, container, size};
+    // Relocating briefly holds the old and new buffers.
+    if (!reporter.wants(key, 3 * size * sizeof(typename List::value_type))) {
+        return;
+    }
+    reporter.measure(key, make, [size](List& list) {
+        for (std::size_t i = 0; i < size; ++i) {
+            list.emplace_back(typename List::value_type());
+        }
+    });
+}
+
+template <class List>
+void run_array_list(bench::Reporter& reporter, const std::size_t size,
+                    const char* type) {
+    run_kind<List>(reporter, size, type, "al::ArrayList",
+                   [] { return List(); });
+}
+
+/// Reserves room for the case rather than the default range, which would
+/// run out of address space across the thousands of lists built per sample.
+template <class List>
+void run_virtual(bench::Reporter& reporter, const std::size_t size,
+                 const char* type) {
+    using Allocator = typename List::allocator_type;
+    run_kind<List>(reporter, size, type, "al::VirtualArrayList", [size] {
+        return List(Allocator(2 * size * sizeof(typename List::value_type)));
+    });
+}
+
+const bench::RegisterSuite Registered("virtual", [](bench::Reporter& reporter) {
+    for (const auto size : bench::sizes(reporter.options())) {
+        // Trivially relocatable elements grow with realloc, anything else is
+        // moved one by one; the reserved range does neither.
+        run_array_list<al::ArrayList<std::uint64_t>>(reporter, size,
+                                                     "uint64_t");
+        run_virtual<al::VirtualArrayList<std::uint64_t>>(reporter, size,
+                                                         "uint64_t");
+        run_array_list<al::ArrayList<std::string>>(reporter, size, "string");
+        run_virtual<al::VirtualArrayList<std::string>>(reporter, size,
+                                                       "string");
+    }
+});
+
+}  // namespace
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <new>
+
+#include "array_list.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace al {
+
+/// Transparent huge pages on x86-64 and most arm64 kernels.
+constexpr size_t HugePageSize = size_t{2} << 20U;
+
+/// Allocator whose allocations start on an `Alignment` boundary, so
+/// `data()` of an ArrayList using it can be loaded from with aligned vector
+/// instructions and needs no peeling.
+///
+/// Allocations of at least `HugePageThreshold` bytes, if that is not zero,
+/// are instead aligned to and padded out to whole huge pages and, on Linux,
+/// marked with `MADV_HUGEPAGE`, so a large buffer takes a few TLB entries
+/// rather than one per 4K page. This only helps where transparent huge pages
+/// are set to `madvise` or `always`.
+template <class Type, size_t Alignment = 64, size_t HugePageThreshold = 0>
+class AlignedAllocator {
+    static_assert(Alignment != 0 and (Alignment & (Alignment - 1)) == 0,
+                  "Requires a power of two alignment");
+    static_assert(Alignment >= alignof(Type),
+                  "Requires at least the alignment of the type");
+
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+
+    template <class Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, Alignment, HugePageThreshold>;
+    };
+    // NOLINTEND
+
+    AlignedAllocator() noexcept = default;
+
+    template <class Other>
+    AlignedAllocator(  // NOLINT
+        const AlignedAllocator<Other, Alignment, HugePageThreshold>&
+        /* other */) noexcept {}
+
+    AL_NODISCARD auto allocate(const size_t count) -> Type* {
+        if (count > (static_cast<size_t>(-1) - HugePageSize) / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        const auto bytes = count * sizeof(Type);
+        if (!uses_huge_pages(bytes)) {
+            return static_cast<Type*>(
+                ::operator new(bytes, std::align_val_t(Alignment)));
+        }
+        const auto padded = huge_page_bytes(bytes);
+        void* const block =
+            ::operator new(padded, std::align_val_t(HugePageSize));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        // Only a hint: without transparent huge pages the buffer stays on
+        // small pages.
+        ::madvise(block, padded, MADV_HUGEPAGE);
+#endif
+        return static_cast<Type*>(block);
+    }
+
+    auto deallocate(Type* const ptr, const size_t count) noexcept -> void {
+        const auto bytes = count * sizeof(Type);
+        if (!uses_huge_pages(bytes)) {
+            ::operator delete(ptr, std::align_val_t(Alignment));
+            return;
+        }
+        ::operator delete(ptr, std::align_val_t(HugePageSize));
+    }
+
+   private:
+    static constexpr auto uses_huge_pages(const size_t bytes) noexcept
+        -> bool {
+        return HugePageThreshold != 0 and bytes >= HugePageThreshold;
+    }
+
+    static constexpr auto huge_page_bytes(const size_t bytes) noexcept
+        -> size_t {
+        return (bytes + HugePageSize - 1) / HugePageSize * HugePageSize;
+    }
+
+    friend constexpr auto operator==(
+        const AlignedAllocator& /* self */,
+        const AlignedAllocator& /* that */) noexcept -> bool {
+        return true;
+    }
+
+    friend constexpr auto operator!=(
+        const AlignedAllocator& /* self */,
+        const AlignedAllocator& /* that */) noexcept -> bool {
+        return false;
+    }
+};
+
+/// An ArrayList whose `data()` is aligned to `Alignment` bytes.
+template <typename Type, size_t Alignment = 64,
+          typename GrowthPolicy = GeometricGrowth<>>
+using AlignedArrayList =
+    ArrayList<Type, AlignedAllocator<Type, Alignment>, GrowthPolicy>;
+
+/// An ArrayList that is cache line aligned, and backed by huge pages once it
+/// reaches `Threshold` bytes.
+template <typename Type, size_t Threshold = HugePageSize,
+          typename GrowthPolicy = GeometricGrowth<>>
+using HugePageArrayList =
+    ArrayList<Type, AlignedAllocator<Type, 64, Threshold>, GrowthPolicy>;
+
+}  // namespace al
+
+#endif  // ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,232 @@
+#ifndef ARENA_ALLOCATOR_HPP
+#define ARENA_ALLOCATOR_HPP
+
+#include <cstdint>
+
+#include "array_list.hpp"
+
+#if AL_HAS_CXX17 && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define AL_HAS_MEMORY_RESOURCE 1
+#endif
+#endif
+
+#ifndef AL_HAS_MEMORY_RESOURCE
+#define AL_HAS_MEMORY_RESOURCE 0
+#endif
+
+namespace al {
+
+/// A bump allocator over a chain of geometrically growing blocks. Individual
+/// deallocations are free, and everything is returned at once by `release`
+/// or when the arena is destroyed. The most recent allocation can be grown or
+/// given back in place.
+class Arena {
+   public:
+    static constexpr size_t DefaultBlockSize = 64U * 1024U;
+
+    explicit Arena(const size_t initial_block_size = DefaultBlockSize) noexcept
+        : next_block_size_(initial_block_size) {}
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+    ~Arena() { release(); }
+
+    AL_NODISCARD auto allocate(const size_t bytes, const size_t alignment)
+        -> void* {
+        auto* result = align_current(alignment);
+        if (result == nullptr or bytes > available_from(result)) {
+            add_block(bytes + alignment);
+            result = align_current(alignment);
+        }
+        current_ = result + bytes;
+        last_allocation_ = result;
+        return result;
+    }
+
+    /// Only the most recent allocation is given back; the rest is reclaimed
+    /// by `release`.
+    auto deallocate(void* const ptr, const size_t bytes) noexcept -> void {
+        auto* const block = static_cast<unsigned char*>(ptr);
+        if (block == last_allocation_ and block + bytes == current_) {
+            current_ = block;
+            last_allocation_ = nullptr;
+        }
+    }
+
+    /// Grows the most recent allocation to `new_bytes` if it still fits in
+    /// the current block.
+    AL_NODISCARD auto try_extend(void* const ptr, const size_t old_bytes,
+                                 const size_t new_bytes) noexcept -> bool {
+        auto* const block = static_cast<unsigned char*>(ptr);
+        if (block != last_allocation_ or block + old_bytes != current_ or
+            new_bytes - old_bytes > available_from(current_)) {
+            return false;
+        }
+        current_ = block + new_bytes;
+        return true;
+    }
+
+    /// Frees every block. All memory handed out by the arena becomes invalid.
+    auto release() noexcept -> void {
+        while (head_ != nullptr) {
+            auto* const next = head_->next;
+            ::operator delete(static_cast<void*>(head_));
+            head_ = next;
+        }
+        current_ = nullptr;
+        end_ = nullptr;
+        last_allocation_ = nullptr;
+    }
+
+    AL_NODISCARD auto bytes_reserved() const noexcept -> size_t {
+        size_t total = 0;
+        for (auto* block = head_; block != nullptr; block = block->next) {
+            total += block->size;
+        }
+        return total;
+    }
+
+   private:
+    struct Block {
+        Block* next;
+        size_t size;
+    };
+
+    auto align_current(const size_t alignment) const noexcept
+        -> unsigned char* {
+        if (current_ == nullptr) {
+            return nullptr;
+        }
+        const auto address = reinterpret_cast<std::uintptr_t>(current_);
+        const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+        if (aligned > reinterpret_cast<std::uintptr_t>(end_)) {
+            return nullptr;
+        }
+        return current_ + (aligned - address);
+    }
+
+    auto available_from(const unsigned char* const position) const noexcept
+        -> size_t {
+        return static_cast<size_t>(end_ - position);
+    }
+
+    auto add_block(const size_t minimum) -> void {
+        auto size = next_block_size_;
+        while (size < minimum + sizeof(Block)) {
+            size *= 2;
+        }
+        auto* const block = static_cast<Block*>(::operator new(size));
+        block->next = head_;
+        block->size = size;
+        head_ = block;
+
+        current_ = reinterpret_cast<unsigned char*>(block + 1);
+        end_ = reinterpret_cast<unsigned char*>(block) + size;
+        last_allocation_ = nullptr;
+        next_block_size_ = size * 2;
+    }
+
+    Block* head_ = nullptr;
+    unsigned char* current_ = nullptr;
+    unsigned char* end_ = nullptr;
+    unsigned char* last_allocation_ = nullptr;
+    size_t next_block_size_;
+};
+
+/// Allocator handing out memory from an `Arena`. ArrayList uses `try_extend`
+/// to grow the buffer in place while it is the arena's latest allocation.
+template <class Type>
+class ArenaAllocator {
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    // NOLINTEND
+
+    explicit ArenaAllocator(Arena& arena) noexcept
+        : arena_(std::addressof(arena)) {}
+
+    template <class Other>
+    ArenaAllocator(const ArenaAllocator<Other>& other) noexcept  // NOLINT
+        : arena_(other.arena_) {}
+
+    AL_NODISCARD auto allocate(const size_t count) -> Type* {
+        return static_cast<Type*>(
+            arena_->allocate(count * sizeof(Type), alignof(Type)));
+    }
+
+    auto deallocate(Type* const ptr, const size_t count) noexcept -> void {
+        arena_->deallocate(ptr, count * sizeof(Type));
+    }
+
+    AL_NODISCARD auto try_extend(Type* const ptr, const size_t old_count,
+                                 const size_t new_count) noexcept -> bool {
+        return arena_->try_extend(ptr, old_count * sizeof(Type),
+                                  new_count * sizeof(Type));
+    }
+
+    AL_NODISCARD auto arena() const noexcept -> Arena& { return *arena_; }
+
+   private:
+    template <class Other>
+    friend class ArenaAllocator;
+
+    friend auto operator==(const ArenaAllocator& self,
+                           const ArenaAllocator& that) noexcept -> bool {
+        return self.arena_ == that.arena_;
+    }
+
+    friend auto operator!=(const ArenaAllocator& self,
+                           const ArenaAllocator& that) noexcept -> bool {
+        return self.arena_ != that.arena_;
+    }
+
+    Arena* arena_;
+};
+
+#if AL_HAS_MEMORY_RESOURCE
+/// Exposes an `Arena` as a `std::pmr::memory_resource`.
+class ArenaResource : public std::pmr::memory_resource {
+   public:
+    explicit ArenaResource(Arena& arena) noexcept
+        : arena_(std::addressof(arena)) {}
+
+    AL_NODISCARD auto arena() const noexcept -> Arena& { return *arena_; }
+
+   private:
+    auto do_allocate(const size_t bytes, const size_t alignment)
+        -> void* override {
+        return arena_->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* const ptr, const size_t bytes,
+                       const size_t /* alignment */) -> void override {
+        arena_->deallocate(ptr, bytes);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override {
+        const auto* const resource = dynamic_cast<const ArenaResource*>(&other);
+        return resource != nullptr and resource->arena_ == arena_;
+    }
+
+    Arena* arena_;
+};
+
+namespace pmr {
+
+template <typename Type, typename GrowthPolicy = GeometricGrowth<>>
+using ArrayList =
+    al::ArrayList<Type, std::pmr::polymorphic_allocator<Type>, GrowthPolicy>;
+
+}  // namespace pmr
+#endif  // ^^^ AL_HAS_MEMORY_RESOURCE
+
+}  // namespace al
+
+#endif  // ARENA_ALLOCATOR_HPP
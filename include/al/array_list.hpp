@@ -31,10 +31,13 @@
 #define AL_HAS_CONCEPTS (__cpp_concepts >= 201907UL)
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdlib>
 #include <cstring>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -55,14 +58,15 @@
 #define AL_MSVC 1
 #define AL_CLANG 0
 #define AL_GCC 0
-#elif defined(__GNUC__)
-#define AL_GCC 1
-#define AL_MSVC 0
-#define AL_CLANG 0
 #elif defined(__clang__)
+// Tested before __GNUC__, which clang defines as well.
 #define AL_CLANG 1
 #define AL_MSVC 0
 #define AL_GCC 0
+#elif defined(__GNUC__)
+#define AL_GCC 1
+#define AL_MSVC 0
+#define AL_CLANG 0
 #else
 #define AL_GCC 0
 #define AL_MSVC 0
@@ -85,6 +89,14 @@ constexpr auto operator""_UZ(const unsigned long long value) -> size_t {
     return static_cast<size_t>(value);
 }
 
+/// What `allocate_at_least` returns: a buffer of `count` elements, at least
+/// as many as were asked for. Mirrors C++23's `std::allocation_result`.
+template <class Pointer, class Size = size_t>
+struct AllocationResult {
+    Pointer ptr;
+    Size count;
+};
+
 namespace detail {
 
 struct First {};
@@ -94,8 +106,9 @@ template <class Ty1, class Ty2,
           bool DerivesFromFirst =
               std::is_empty<Ty1>::value and not std::is_final<Ty1>::value>
 struct CompressedPair : private Ty1 {
-    template <typename std::enable_if<std::is_constructible<Ty1>::value and
-                                          std::is_constructible<Ty2>::value,
+    template <class T1 = Ty1, class T2 = Ty2,
+              typename std::enable_if<std::is_constructible<T1>::value and
+                                          std::is_constructible<T2>::value,
                                       int>::type = 0>
     CompressedPair() {}
 
@@ -122,8 +135,9 @@ struct CompressedPair : private Ty1 {
 
 template <class Ty1, class Ty2>
 struct CompressedPair<Ty1, Ty2, false> {
-    template <typename std::enable_if<std::is_constructible<Ty1>::value and
-                                          std::is_constructible<Ty2>::value,
+    template <class T1 = Ty1, class T2 = Ty2,
+              typename std::enable_if<std::is_constructible<T1>::value and
+                                          std::is_constructible<T2>::value,
                                       int>::type = 0>
     CompressedPair() {}
 
@@ -184,6 +198,142 @@ template <class Iter>
 constexpr inline bool IsRandomAccessIterator =
     IsIteratorCategory<Iter, std::random_access_iterator_tag>;
 
+template <class...>
+using VoidT = void;
+
+template <class Ally, class Size, class = void>
+struct HasAllocateAtLeast : std::false_type {};
+
+template <class Ally, class Size>
+struct HasAllocateAtLeast<
+    Ally, Size,
+    VoidT<decltype(std::declval<Ally&>().allocate_at_least(
+        std::declval<Size>()))>> : std::true_type {};
+
+template <class Ally, class Pointer, class Size, class = void>
+struct HasTryExtend : std::false_type {};
+
+template <class Ally, class Pointer, class Size>
+struct HasTryExtend<
+    Ally, Pointer, Size,
+    VoidT<decltype(std::declval<Ally&>().try_extend(
+        std::declval<Pointer>(), std::declval<Size>(), std::declval<Size>()))>>
+    : std::true_type {};
+
+template <class Ally, class Pointer, class Size, class = void>
+struct HasTryShrink : std::false_type {};
+
+template <class Ally, class Pointer, class Size>
+struct HasTryShrink<
+    Ally, Pointer, Size,
+    VoidT<decltype(std::declval<Ally&>().try_shrink(
+        std::declval<Pointer>(), std::declval<Size>(), std::declval<Size>()))>>
+    : std::true_type {};
+
+template <class Policy, class = void>
+struct HasOnClear : std::false_type {};
+
+template <class Policy>
+struct HasOnClear<Policy, VoidT<decltype(std::declval<Policy&>().on_clear(
+                              size_t{}, size_t{}, size_t{}, size_t{}))>>
+    : std::true_type {};
+
+/// Allocators may provide `allocate_at_least(count)`, as `std::allocator` does
+/// since C++23, to report the real size of the block they handed out so the
+/// list can use all of it.
+template <class AltyTraits, class Ally, class Size>
+AL_CONSTEXPR_CXX20 auto allocate_at_least(Ally& ally, const Size count) ->
+    typename std::enable_if<
+        HasAllocateAtLeast<Ally, Size>::value,
+        AllocationResult<typename AltyTraits::pointer, Size>>::type {
+    const auto result = ally.allocate_at_least(count);
+    return {result.ptr, static_cast<Size>(result.count)};
+}
+
+template <class AltyTraits, class Ally, class Size>
+AL_CONSTEXPR_CXX20 auto allocate_at_least(Ally& ally, const Size count) ->
+    typename std::enable_if<
+        !HasAllocateAtLeast<Ally, Size>::value,
+        AllocationResult<typename AltyTraits::pointer, Size>>::type {
+    return {AltyTraits::allocate(ally, count), count};
+}
+
+/// Allocators may provide `try_extend(ptr, old_count, new_count)` to grow an
+/// allocation without moving it; it returns whether the allocation grew.
+template <class Ally, class Pointer, class Size>
+AL_CONSTEXPR_CXX20 auto try_extend(Ally& ally, Pointer ptr,
+                                   const Size old_count,
+                                   const Size new_count) ->
+    typename std::enable_if<HasTryExtend<Ally, Pointer, Size>::value,
+                            bool>::type {
+    return static_cast<bool>(ally.try_extend(ptr, old_count, new_count));
+}
+
+template <class Ally, class Pointer, class Size>
+AL_CONSTEXPR_CXX20 auto try_extend(Ally& /* ally */, Pointer /* ptr */,
+                                   const Size /* old_count */,
+                                   const Size /* new_count */) ->
+    typename std::enable_if<!HasTryExtend<Ally, Pointer, Size>::value,
+                            bool>::type {
+    return false;
+}
+
+/// Allocators may provide `try_shrink(ptr, old_count, new_count)` to give
+/// back the end of an allocation without moving it; it returns whether the
+/// allocation shrank. The pointer stays valid, and is later deallocated with
+/// `new_count`.
+template <class Ally, class Pointer, class Size>
+AL_CONSTEXPR_CXX20 auto try_shrink(Ally& ally, Pointer ptr,
+                                   const Size old_count,
+                                   const Size new_count) ->
+    typename std::enable_if<HasTryShrink<Ally, Pointer, Size>::value,
+                            bool>::type {
+    return static_cast<bool>(ally.try_shrink(ptr, old_count, new_count));
+}
+
+template <class Ally, class Pointer, class Size>
+AL_CONSTEXPR_CXX20 auto try_shrink(Ally& /* ally */, Pointer /* ptr */,
+                                   const Size /* old_count */,
+                                   const Size /* new_count */) ->
+    typename std::enable_if<!HasTryShrink<Ally, Pointer, Size>::value,
+                            bool>::type {
+    return false;
+}
+
+/// The last shrink of a list whose allocator may return more than it was
+/// asked for: the count asked for, and the capacity that came back. While
+/// the capacity is unchanged, shrinking to no less than that count would
+/// get the same block again, so it is skipped.
+template <class Size, bool = true>
+struct FittedBlock {
+    constexpr auto fits(const Size target, const Size capacity) const noexcept
+        -> bool {
+        return requested != 0 and requested <= target and
+               fitted_capacity == capacity;
+    }
+
+    AL_CONSTEXPR_CXX20 void fit(const Size target,
+                                const Size capacity) noexcept {
+        requested = target;
+        fitted_capacity = capacity;
+    }
+
+    Size requested = 0;
+    Size fitted_capacity = 0;
+};
+
+/// Allocators returning exactly what was asked need no record.
+template <class Size>
+struct FittedBlock<Size, false> {
+    constexpr auto fits(const Size /* target */,
+                        const Size /* capacity */) const noexcept -> bool {
+        return false;
+    }
+
+    AL_CONSTEXPR_CXX20 void fit(const Size /* target */,
+                                const Size /* capacity */) noexcept {}
+};
+
 template <class AltyTraits, class Type, class Ally>
 AL_CONSTEXPR_CXX20 auto destroy_in_place(Type* value, Ally&& ally) noexcept ->
     typename std::enable_if<
@@ -238,8 +388,172 @@ AL_CONSTEXPR_CXX20 auto destruct_all_elements(It begin, Sentinel end,
         std::is_trivially_destructible<typename AltyTraits::value_type>::value,
         void>::type {}
 
+constexpr auto floor_log2(size_t value) noexcept -> size_t {
+    size_t result = 0;
+    while (value >>= 1U) {
+        ++result;
+    }
+    return result;
+}
+
+/// Rounds a request up to the size classes used by jemalloc: 8, then steps of
+/// 16 up to 128, then four classes per power of two.
+constexpr auto jemalloc_size_class(const size_t bytes) noexcept -> size_t {
+    if (bytes <= 8) {
+        return 8;
+    }
+    if (bytes <= 128) {
+        return (bytes + 15) & ~size_t{15};
+    }
+    const auto spacing = size_t{1} << (floor_log2(bytes - 1) - 2);
+    if (bytes > static_cast<size_t>(-1) - spacing) {
+        return bytes;
+    }
+    return (bytes + spacing - 1) & ~(spacing - 1);
+}
+
+struct RelocateByMove {};
+struct RelocateByMemcpy {};
+struct RelocateByRealloc {};
+
+/// Moves `count` elements into uninitialized, non-overlapping storage at
+/// `dest`, leaving the source storage uninitialized.
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_n(Pointer first, const size_t count,
+                                   Pointer dest, Ally& ally, RelocateByMove) {
+    if (count > 0) {
+        std::uninitialized_move_n(first, count, dest);
+        destroy_range<AltyTraits>(first, first + count, ally);
+    }
+}
+
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_n(Pointer first, const size_t count,
+                                   Pointer dest, Ally& /* ally */,
+                                   RelocateByMemcpy) {
+    if (count > 0) {
+        std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                    count * sizeof(*first));
+    }
+}
+
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_n(Pointer first, const size_t count,
+                                   Pointer dest, Ally& ally,
+                                   RelocateByRealloc) {
+    relocate_n<AltyTraits>(first, count, dest, ally, RelocateByMemcpy{});
+}
+
+/// Moves `[first, last)` to the possibly overlapping storage at `dest`. The
+/// destination must be uninitialized wherever it does not overlap the source.
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_overlapping(Pointer first, Pointer last,
+                                             Pointer dest, Ally& ally,
+                                             RelocateByMove) {
+    if (dest > first) {
+        auto dest_last = dest + (last - first);
+        while (last != first) {
+            AltyTraits::construct(ally, --dest_last, std::move(*--last));
+            AltyTraits::destroy(ally, last);
+        }
+    } else {
+        for (; first != last; ++first, ++dest) {
+            AltyTraits::construct(ally, dest, std::move(*first));
+            AltyTraits::destroy(ally, first);
+        }
+    }
+}
+
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_overlapping(Pointer first, Pointer last,
+                                             Pointer dest, Ally& /* ally */,
+                                             RelocateByMemcpy) {
+    if (first != last) {
+        std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                     static_cast<size_t>(last - first) * sizeof(*first));
+    }
+}
+
+template <class AltyTraits, class Pointer, class Ally>
+AL_CONSTEXPR_CXX20 void relocate_overlapping(Pointer first, Pointer last,
+                                             Pointer dest, Ally& ally,
+                                             RelocateByRealloc) {
+    relocate_overlapping<AltyTraits>(first, last, dest, ally,
+                                     RelocateByMemcpy{});
+}
+
+/// Types whose values are equal exactly when their bytes are, so ranges of
+/// them compare with `memcmp`.
+template <class Type>
+struct IsBitwiseComparable
+    : std::integral_constant<bool, std::is_integral<Type>::value or
+                                       std::is_enum<Type>::value or
+                                       std::is_pointer<Type>::value> {};
+
+/// Types ordered the same way `memcmp` orders bytes.
+template <class Type>
+struct IsBytewiseOrdered
+    : std::integral_constant<bool, std::is_integral<Type>::value and
+                                       std::is_unsigned<Type>::value and
+                                       sizeof(Type) == 1> {};
+
+template <class Type>
+AL_CONSTEXPR_CXX20 auto equal_n(const Type* self, const Type* that,
+                                const size_t count, std::true_type) noexcept
+    -> bool {
+#if AL_HAS_CXX20
+    if (std::is_constant_evaluated()) {
+        return std::equal(self, self + count, that);
+    }
+#endif
+    return count == 0 or std::memcmp(self, that, count * sizeof(Type)) == 0;
+}
+
+template <class Type>
+AL_CONSTEXPR_CXX20 auto equal_n(const Type* self, const Type* that,
+                                const size_t count, std::false_type) -> bool {
+    return std::equal(self, self + count, that);
+}
+
+template <class Type>
+AL_CONSTEXPR_CXX20 auto equal_n(const Type* self, const Type* that,
+                                const size_t count) -> bool {
+    return equal_n(self, that, count, IsBitwiseComparable<Type>{});
+}
+
+template <class Type>
+AL_CONSTEXPR_CXX20 auto less_n(const Type* self, const size_t self_count,
+                               const Type* that, const size_t that_count,
+                               std::true_type) noexcept -> bool {
+    const auto common = self_count < that_count ? self_count : that_count;
+#if AL_HAS_CXX20
+    if (std::is_constant_evaluated()) {
+        return std::lexicographical_compare(self, self + self_count, that,
+                                            that + that_count);
+    }
+#endif
+    const auto order = common == 0 ? 0 : std::memcmp(self, that, common);
+    return order < 0 or (order == 0 and self_count < that_count);
+}
+
+template <class Type>
+AL_CONSTEXPR_CXX20 auto less_n(const Type* self, const size_t self_count,
+                               const Type* that, const size_t that_count,
+                               std::false_type) -> bool {
+    return std::lexicographical_compare(self, self + self_count, that,
+                                        that + that_count);
+}
+
 }  // namespace detail
 
+/// Types for which moving to a new address and destroying the source is
+/// equivalent to a `memcpy`. Specialize to `std::true_type` to opt a type in.
+template <class Type>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<Type> {};
+
+template <class Type>
+struct IsTriviallyRelocatable<std::unique_ptr<Type>> : std::true_type {};
+
 /// \deprecated
 /// This is the difference in size. old capacity + this value is the new
 /// prefered size
@@ -256,7 +570,135 @@ struct ArrayListDefaultGrowthDifference {
     }
 };
 
-template <typename Type, typename Allocator = std::allocator<Type>>
+/// Growth policies are called with the current capacity, the number of
+/// elements that must fit, the largest representable capacity and the element
+/// size in bytes, and return the capacity to grow to.
+
+/// Grows the capacity by a factor of `Numerator / Denominator`.
+template <size_t Numerator = 3, size_t Denominator = 2>
+struct GeometricGrowth {
+    static_assert(Denominator > 0 and Numerator > Denominator,
+                  "Requires a growth factor greater than one");
+
+    constexpr auto operator()(const size_t old_capacity, const size_t required,
+                              const size_t max_size,
+                              const size_t /* element_size */) const noexcept
+        -> size_t {
+        constexpr auto Step = Numerator - Denominator;
+        if (old_capacity / Denominator > max_size / Step) {
+            return max_size;
+        }
+        const auto extra = old_capacity / Denominator * Step +
+                           old_capacity % Denominator * Step / Denominator;
+        if (extra > max_size - old_capacity) {
+            return max_size;
+        }
+        const auto growth = old_capacity + extra;
+
+        if (growth < required) {
+            return required;
+        }
+        return growth;
+    }
+};
+
+/// Rounds the capacity chosen by `Inner` up to whole pages once the buffer is
+/// at least a page in size.
+template <class Inner = GeometricGrowth<>, size_t PageSize = 4096>
+struct PageAlignedGrowth : Inner {
+    constexpr auto operator()(const size_t old_capacity, const size_t required,
+                              const size_t max_size,
+                              const size_t element_size) const noexcept
+        -> size_t {
+        const auto wanted = static_cast<const Inner&>(*this)(
+            old_capacity, required, max_size, element_size);
+        const auto bytes = wanted * element_size;
+        if (bytes < PageSize or bytes > static_cast<size_t>(-1) - PageSize) {
+            return wanted;
+        }
+        const auto rounded = (bytes + PageSize - 1) / PageSize * PageSize;
+        return rounded / element_size;
+    }
+};
+
+/// Rounds the capacity chosen by `Inner` up to the next jemalloc size class,
+/// so the slack the allocator would hand out anyway becomes usable capacity.
+template <class Inner = GeometricGrowth<>>
+struct JemallocSizeClassGrowth : Inner {
+    constexpr auto operator()(const size_t old_capacity, const size_t required,
+                              const size_t max_size,
+                              const size_t element_size) const noexcept
+        -> size_t {
+        const auto wanted = static_cast<const Inner&>(*this)(
+            old_capacity, required, max_size, element_size);
+        if (wanted == 0) {
+            return wanted;
+        }
+        const auto capacity =
+            detail::jemalloc_size_class(wanted * element_size) / element_size;
+        return capacity < max_size ? capacity : max_size;
+    }
+};
+
+/// Gives capacity back after `Rounds` consecutive clears of a list that was
+/// less than `1 / LowWaterDivisor` full, shrinking to the growth `Inner` would
+/// pick for the largest of those sizes. Any well-used clear resets the count,
+/// so a list that alternates between small and large batches keeps its
+/// buffer.
+template <class Inner = GeometricGrowth<>, size_t Rounds = 4,
+          size_t LowWaterDivisor = 4>
+struct ReclaimingGrowth : Inner {
+    static_assert(Rounds > 0 and LowWaterDivisor > 1,
+                  "Requires at least one round and a low water mark below 1");
+
+    /// Called by `clear` with the size being cleared, returns the capacity to
+    /// keep.
+    auto on_clear(const size_t size, const size_t capacity,
+                  const size_t max_size, const size_t element_size) noexcept
+        -> size_t {
+        if (size >= capacity / LowWaterDivisor) {
+            low_rounds_ = 0;
+            high_water_ = 0;
+            return capacity;
+        }
+        high_water_ = size > high_water_ ? size : high_water_;
+        if (++low_rounds_ < Rounds) {
+            return capacity;
+        }
+        const auto target =
+            high_water_ == 0
+                ? 0
+                : static_cast<const Inner&>(*this)(high_water_, high_water_,
+                                                   max_size, element_size);
+        low_rounds_ = 0;
+        high_water_ = 0;
+        return target;
+    }
+
+   private:
+    size_t high_water_ = 0;
+    size_t low_rounds_ = 0;
+};
+
+/// Stats policies observe the buffer of an ArrayList. `on_reallocate` is
+/// called whenever the capacity changes, with an old capacity of zero for a
+/// first allocation, `on_deallocate` when a buffer is freed, and `on_resize`
+/// after every change to the size or the capacity. The default records nothing;
+/// see "al/array_list_stats.hpp" for one that does.
+struct NoStats {
+    constexpr void on_reallocate(size_t /* old_capacity */,
+                                 size_t /* new_capacity */,
+                                 size_t /* relocated */,
+                                 size_t /* element_size */) noexcept {}
+    constexpr void on_deallocate(size_t /* capacity */,
+                                 size_t /* element_size */) noexcept {}
+    constexpr void on_resize(size_t /* size */, size_t /* capacity */,
+                             size_t /* element_size */) noexcept {}
+};
+
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = GeometricGrowth<>,
+          typename StatsPolicy = NoStats>
 AL_REQUIRES(std::is_object<Type>::value)
 class ArrayList {
     static_assert(
@@ -273,6 +715,8 @@ class ArrayList {
    public:
     using value_type = Type;
     using allocator_type = Alty;
+    using growth_policy_type = GrowthPolicy;
+    using stats_policy_type = StatsPolicy;
     using pointer = typename AltyTraits::pointer;
     using const_pointer = typename AltyTraits::const_pointer;
     using reference = Type&;
@@ -290,36 +734,61 @@ class ArrayList {
     }
 
    private:
+    static constexpr bool RelocatesByMemcpy =
+        IsTriviallyRelocatable<Type>::value and
+        std::is_pointer<pointer>::value;
+
+    // std::allocator is stateless and only hands out `operator new` memory,
+    // so for these lists we own the heap calls and can grow with `realloc`.
+    static constexpr bool UsesMallocStorage =
+        RelocatesByMemcpy and
+        std::is_same<Alty, std::allocator<Type>>::value and
+        alignof(Type) <= alignof(std::max_align_t);
+
+    using RelocationTag = typename std::conditional<
+        UsesMallocStorage, detail::RelocateByRealloc,
+        typename std::conditional<RelocatesByMemcpy, detail::RelocateByMemcpy,
+                                  detail::RelocateByMove>::type>::type;
+
+    // Only lists that allocate through `allocate_at_least` can be handed
+    // slack. Lists on malloc storage never call it, and std::allocator
+    // returns exactly what was asked, so neither pays for a FittedBlock.
+    static constexpr bool ReceivesSlack =
+        detail::HasAllocateAtLeast<Alty, size_type>::value and
+        not UsesMallocStorage and
+        not std::is_same<Alty, std::allocator<Type>>::value;
+
     constexpr auto calculate_growth(const size_type new_size) const noexcept
         -> size_type {
-        const auto old_capacity = capacity();
-
-        if (new_size > max_size() - old_capacity / 2) {
-            return max_size();
-        }
-        const auto growth = old_capacity + (old_capacity / 2);
-
-        if (growth < new_size) {
-            return new_size;
-        }
-        return growth;
+        return static_cast<size_type>(growth_policy()(
+            capacity(), new_size, max_size(), sizeof(value_type)));
     }
 
     AL_NODISCARD constexpr auto get_allocator() noexcept -> allocator_type& {
         return compressed_.get_first();
     }
 
+    AL_NODISCARD constexpr auto get_allocator() const noexcept
+        -> const allocator_type& {
+        return compressed_.get_first();
+    }
+
    public:
     constexpr ArrayList() noexcept = default;
 
+    AL_CONSTEXPR_CXX20 explicit ArrayList(const allocator_type& alloc) noexcept
+        : compressed_(detail::First{}, alloc) {}
+
     AL_CONSTEXPR_CXX20 explicit ArrayList(
         const size_type capacity,
         const allocator_type& alloc = allocator_type())
-        : compressed_(
-              alloc, Payload{AltyTraits::allocate(get_allocator(), capacity)}) {
+        : compressed_(detail::First{}, alloc) {
+        const auto block = allocate_storage(capacity);
         auto& p = payload();
-        p.end = p.data + capacity;
+        p.data = block.ptr;
+        p.end = p.data + block.count;
         p.current = p.data;
+        record_reallocation(0, 0);
     }
 
 // NOLINTBEGIN
@@ -335,14 +804,7 @@ class ArrayList {
                                 std::true_type>::type /* */
         = {})
         : compressed_(detail::First{}, alloc) {
-        const auto length = static_cast<size_t>(std::distance(first, last));
-        auto& p = payload();
-
-        p.data = AltyTraits::allocate(get_allocator(), length);
-        p.end = p.data + length;
-        p.current = p.data + length;
-
-        std::uninitialized_copy(first, last, p.data);
+        construct_from_range(first, last, std::random_access_iterator_tag{});
     }
 
 #if AL_HAS_CONCEPTS
@@ -357,9 +819,7 @@ class ArrayList {
                                 std::false_type>::type /* */
         = {})
         : compressed_(detail::First{}, alloc) {
-        for (; first != last; ++first) {
-            push_back(*first);
-        }
+        construct_from_range(first, last, detail::IterConcatenateType<Iter>{});
     }
 
     AL_CONSTEXPR_CXX20 ArrayList(std::initializer_list<Type> list,
@@ -370,21 +830,21 @@ class ArrayList {
     AL_CONSTEXPR_CXX20 explicit ArrayList(
         const Container& container,
         const allocator_type& alloc = allocator_type())
-        : ArrayList(container.begin(), container.end(), alloc) {
-        const auto container_size = std::size(container);
-        reserve(container_size);
-        auto& p = payload();
-        std::uninitialized_copy(std::begin(container), std::end(container),
-                                p.data);
-        p.current = p.data + container_size;
-    }
+        : ArrayList(std::begin(container), std::end(container), alloc) {}
+
+    AL_CONSTEXPR_CXX20 ArrayList(const ArrayList& other)
+        : ArrayList(other.begin(), other.end(),
+                    AltyTraits::select_on_container_copy_construction(
+                        other.get_allocator())) {}
 
     AL_CONSTEXPR_CXX20 ArrayList(const ArrayList& other,
-                                 const allocator_type& alloc = allocator_type())
+                                 const allocator_type& alloc)
         : ArrayList(other.begin(), other.end(), alloc) {}
 
     constexpr ArrayList(ArrayList&& other) noexcept
-        : compressed_(std::exchange(other.compressed_, Compressed())) {}
+        : compressed_(std::move(other.compressed_)) {
+        other.payload() = Payload{};
+    }
 
     AL_CONSTEXPR_CXX20 auto operator=(const ArrayList& other) -> ArrayList& {
         if (this != std::addressof(other)) {
@@ -393,13 +853,62 @@ class ArrayList {
         return *this;
     }
 
-    constexpr auto operator=(ArrayList&& other) noexcept -> ArrayList& {
-        destruct_all_elements();
-        deallocate_ptr();
+    constexpr auto operator=(ArrayList&& other) noexcept(
+        AltyTraits::propagate_on_container_move_assignment::value or
+        AltyTraits::is_always_equal::value) -> ArrayList& {
+        if (this != std::addressof(other)) {
+            move_assign(
+                other,
+                typename AltyTraits::propagate_on_container_move_assignment{});
+        }
+        return *this;
+    }
 
-        compressed_ = std::exchange(other.compressed_, Compressed());
+    /// Replaces the contents with `count` copies of `value`. Like every
+    /// assignment, live elements are assigned over and the buffer is only
+    /// reallocated when it is too small.
+    AL_CONSTEXPR_CXX20 void assign(const size_type count, const Type& value) {
+        if (count > capacity()) {
+            replace_storage(count, [&](pointer dest) {
+                std::uninitialized_fill_n(dest, count, value);
+            });
+            return;
+        }
 
-        return *this;
+        auto& p = payload();
+        const auto len = size();
+        std::fill_n(p.data, count < len ? count : len, value);
+        if (count > len) {
+            p.current =
+                std::uninitialized_fill_n(p.current, count - len, value);
+        } else {
+            destroy_range(p.data + count, p.current);
+            p.current = p.data + count;
+        }
+        record_resize();
+    }
+
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    AL_CONSTEXPR_CXX20 void assign(
+        Iter first, Iter last,
+        typename std::enable_if<detail::IsIteratorV<Iter>,
+                                std::true_type>::type /* */
+        = {}) {
+        assign_from(first, last, detail::IterConcatenateType<Iter>{});
+    }
+
+    AL_CONSTEXPR_CXX20 void assign(std::initializer_list<Type> list) {
+        assign_counted(list.begin(), list.size());
+    }
+
+    template <typename Range>
+    AL_CONSTEXPR_CXX20 void assign_range(Range&& range) {
+        assign(std::begin(range), std::end(range));
     }
 
     AL_CONSTEXPR_CXX20 ~ArrayList() {
@@ -429,6 +938,7 @@ class ArrayList {
 
         std::uninitialized_copy(first, last, p.current);
         p.current += length;
+        record_resize();
     }
 
     AL_CONSTEXPR_CXX20 auto push_back(const Type& value) -> void {
@@ -451,8 +961,9 @@ class ArrayList {
         ensure_not_empty();
         // destroy it!
         auto& p = payload();
-        destroy_in_place(p.current);
         --p.current;
+        destroy_in_place(p.current);
+        record_resize();
     }
 
     AL_NODISCARD constexpr auto size() const noexcept -> size_type {
@@ -469,44 +980,89 @@ class ArrayList {
         requires(std::is_constructible<value_type>::value)
 #endif
     {
-        const auto len = size();
-        auto& p = payload();
+        resize_with(new_size, [](pointer first, const size_type count) {
+            std::uninitialized_value_construct_n(first, count);
+        });
+    }
 
-        if (new_size < len) {
-            detail::destroy_range<AltyTraits>(p.data + new_size, p.data + len,
-                                              get_allocator());
-        }
+    /// Like `resize`, but new elements are default-initialized, which leaves
+    /// trivial types such as `int` or `float` uninitialized.
+#if !AL_HAS_CONCEPTS
+    template <typename std::enable_if<
+                  std::is_default_constructible<value_type>::value, int>::type =
+                  0>
+#endif
+    AL_CONSTEXPR_CXX20 void resize_default_init(const size_type new_size)
+#if AL_HAS_CONCEPTS
+        requires(std::is_default_constructible<value_type>::value)
+#endif
+    {
+        resize_with(new_size, [](pointer first, const size_type count) {
+            std::uninitialized_default_construct_n(first, count);
+        });
+    }
 
-        if (capacity() < new_size) {
-            reserve(new_size);
-        }
-        auto* tmp = p.current;
-        p.current = p.data + new_size;
+#if !AL_HAS_CONCEPTS
+    template <typename std::enable_if<
+                  std::is_default_constructible<value_type>::value, int>::type =
+                  0>
+#endif
+    AL_CONSTEXPR_CXX20 void resize_for_overwrite(const size_type new_size)
+#if AL_HAS_CONCEPTS
+        requires(std::is_default_constructible<value_type>::value)
+#endif
+    {
+        resize_default_init(new_size);
+    }
 
-        std::uninitialized_value_construct_n(tmp, p.current - tmp);
+    /// Appends `count` default-initialized elements and returns a pointer to
+    /// the first of them, for the caller to fill in.
+#if !AL_HAS_CONCEPTS
+    template <typename std::enable_if<
+                  std::is_default_constructible<value_type>::value, int>::type =
+                  0>
+#endif
+    AL_CONSTEXPR_CXX20 auto append_uninitialized(const size_type count)
+        -> pointer
+#if AL_HAS_CONCEPTS
+        requires(std::is_default_constructible<value_type>::value)
+#endif
+    {
+        ensure_size_for_elements(count);
+        auto& p = payload();
+        const auto first = p.current;
+        std::uninitialized_default_construct_n(first, count);
+        p.current += count;
+        record_resize();
+        return first;
+    }
+
+    /// Makes room for `count` elements and calls `writer(tail, count)` with
+    /// the uninitialized tail. The writer constructs elements from the start
+    /// of the tail and returns how many it constructed, at most `count`.
+    template <typename Writer>
+    AL_CONSTEXPR_CXX20 auto append_with(const size_type count, Writer&& writer)
+        -> size_type {
+        ensure_size_for_elements(count);
+        auto& p = payload();
+        const auto written = static_cast<size_type>(
+            std::forward<Writer>(writer)(p.current, count));
+        p.current += written;
+        record_resize();
+        return written;
     }
 
     AL_CONSTEXPR_CXX20 void reserve(const size_type new_capacity) {
-        const auto cap = capacity();
-        if (cap >= new_capacity) {
+        if (capacity() >= new_capacity) {
             return;
         }
-
-        const auto len = size();
-
-        auto& p = payload();
-
-        const auto old_ptr = p.data;
-        raw_reserve(new_capacity);
-        if (old_ptr) {
-            if (cap > 0) {
-                if (len > 0) {
-                    std::uninitialized_move_n(old_ptr, len, p.data);
-                }
-                destroy_range(old_ptr, old_ptr + len);
-                deallocate_target_ptr(old_ptr, cap);
-            }
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        if (try_extend_in_place(new_capacity)) {
+            return;
         }
+        reallocate(new_capacity);
     }
 
     AL_NODISCARD constexpr auto operator[](const size_type index) noexcept
@@ -615,56 +1171,175 @@ class ArrayList {
         return rend();
     }
 
+    AL_CONSTEXPR_CXX20 auto insert(const_iterator position, const Type& value)
+        -> iterator {
+        return emplace(position, value);
+    }
+
+    AL_CONSTEXPR_CXX20 auto insert(const_iterator position, Type&& value)
+        -> iterator {
+        return emplace(position, std::move(value));
+    }
+
+    AL_CONSTEXPR_CXX20 auto insert(const_iterator position,
+                                   const size_type count, const Type& value)
+        -> iterator {
+        // The value may alias an element that the insertion moves.
+        const value_type copy(value);
+        return insert_with(index_of(position), count, [&](pointer dest) {
+            std::uninitialized_fill_n(dest, count, copy);
+        });
+    }
+
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    AL_CONSTEXPR_CXX20 auto insert(
+        const_iterator position, Iter first, Iter last,
+        typename std::enable_if<detail::IsIteratorV<Iter>,
+                                std::true_type>::type /* */
+        = {}) -> iterator {
+        return insert_range_at(index_of(position), first, last,
+                               detail::IterConcatenateType<Iter>{});
+    }
+
+    AL_CONSTEXPR_CXX20 auto insert(const_iterator position,
+                                   std::initializer_list<Type> list)
+        -> iterator {
+        return insert(position, list.begin(), list.end());
+    }
+
+    template <typename Range>
+    AL_CONSTEXPR_CXX20 auto insert_range(const_iterator position,
+                                         Range&& range) -> iterator {
+        return insert(position, std::begin(range), std::end(range));
+    }
+
+    template <typename... Args>
+    AL_CONSTEXPR_CXX20 auto emplace(const_iterator position, Args&&... args)
+        -> iterator {
+        const auto index = index_of(position);
+        auto& p = payload();
+        if (index == size() and p.current != p.end) {
+            raw_emplace_back(std::forward<Args>(args)...);
+            return begin() + index;
+        }
+        // The arguments may refer to elements, so build the value before
+        // anything moves.
+        value_type value(std::forward<Args>(args)...);
+        return insert_with(index, 1_UZ, [&](pointer dest) {
+            AltyTraits::construct(get_allocator(), dest, std::move(value));
+        });
+    }
+
     AL_CONSTEXPR_CXX20 auto clear() noexcept -> void {
+        const auto len = size();
         destruct_all_elements();
         auto& p = payload();
         p.current = p.data;
+        record_resize();
+        reclaim_after_clear(len,
+                            detail::HasOnClear<growth_policy_type>{});
+    }
+
+    /// Reduces the capacity to `max(size(), new_capacity)`.
+    AL_CONSTEXPR_CXX20 void shrink_to(const size_type new_capacity) {
+        const auto len = size();
+        const auto target = new_capacity > len ? new_capacity : len;
+        if (target >= capacity() or try_shrink_in_place(target) or
+            payload().fits(target, capacity())) {
+            return;
+        }
+        if (target == 0) {
+            deallocate_ptr();
+            payload() = Payload{};
+            return;
+        }
+        reallocate(target);
+        payload().fit(target, capacity());
     }
 
+    AL_CONSTEXPR_CXX20 void shrink_to_fit() { shrink_to(size()); }
+
     AL_CONSTEXPR_CXX20 auto erase(const_iterator position) -> iterator {
-        const auto index = static_cast<size_type>(position - begin());
-        erase(index);
-        return begin() + index;
+        return erase(index_of(position));
     }
 
     AL_CONSTEXPR_CXX20 auto erase(const size_type index) -> iterator {
-        if (index >= size() or size() == 0) {
-            throw std::out_of_range("Index out of range");
+        ensure_in_range(index);
+        return erase(cbegin() + index, cbegin() + index + 1);
+    }
+
+    /// Removes `[first, last)`, shifting the tail down once.
+    AL_CONSTEXPR_CXX20 auto erase(const_iterator first, const_iterator last)
+        -> iterator {
+        auto& p = payload();
+        const auto target = p.data + index_of(first);
+        if (first != last) {
+            erase_range(target, p.data + index_of(last), RelocationTag{});
         }
-        const auto length = size();
+        return target;
+    }
+
+    /// Removes the element at `index` in O(1) by moving the last element into
+    /// its place. Does not preserve the order of the elements.
+    AL_CONSTEXPR_CXX20 auto swap_remove(const size_type index) -> iterator {
+        ensure_in_range(index);
         auto& p = payload();
-        std::move(p.data + index + 1, p.data + length + 1, p.data + index);
+        const auto target = p.data + index;
+        const auto last = p.current - 1;
+        if (target != last) {
+            *target = std::move(*last);
+        }
         --p.current;
-        return p.data + index;
+        destroy_in_place(p.current);
+        record_resize();
+        return target;
+    }
+
+    AL_CONSTEXPR_CXX20 auto unordered_erase(const_iterator position)
+        -> iterator {
+        return swap_remove(index_of(position));
     }
 
     constexpr explicit operator bool() const noexcept { return !empty(); }
 
+    AL_NODISCARD constexpr auto growth_policy() noexcept
+        -> growth_policy_type& {
+        return compressed_.get_second().get_first();
+    }
+
+    AL_NODISCARD constexpr auto growth_policy() const noexcept
+        -> const growth_policy_type& {
+        return compressed_.get_second().get_first();
+    }
+
+    AL_NODISCARD constexpr auto stats() noexcept -> stats_policy_type& {
+        return compressed_.get_second().get_second().get_first();
+    }
+
+    AL_NODISCARD constexpr auto stats() const noexcept
+        -> const stats_policy_type& {
+        return compressed_.get_second().get_second().get_first();
+    }
+
    private:
     friend constexpr auto operator==(const ArrayList& self,
                                      const ArrayList& that) noexcept -> bool {
         if (self.size() != that.size()) {
             return false;
         }
-        return std::equal(self.begin(), self.end(), that.begin());
+        return detail::equal_n(self.data(), that.data(), self.size());
     }
 
     friend constexpr auto operator<(const ArrayList& self,
                                     const ArrayList& that) noexcept -> bool {
-        auto it = self.begin();
-        auto it2 = that.begin();
-        for (; it != self.end() && it2 != that.end(); ++it, ++it2) {
-            if (!(*it < *it2)) {
-                return false;
-            }
-        }
-        if (it != self.end()) {
-            return false;
-        }
-        if (it2 == that.end()) {
-            return false;
-        }
-        return true;
+        return detail::less_n(self.data(), self.size(), that.data(),
+                              that.size(),
+                              detail::IsBytewiseOrdered<value_type>{});
     }
 
     friend constexpr auto operator>(const ArrayList& self,
@@ -682,25 +1357,480 @@ class ArrayList {
         return !(self < that);
     }
 
+    AL_CONSTEXPR_CXX20 auto index_of(const_iterator position) const noexcept
+        -> size_type {
+        return static_cast<size_type>(position - cbegin());
+    }
+
+    AL_CONSTEXPR_CXX20 void reclaim_after_clear(const size_type /* len */,
+                                                std::false_type) noexcept {}
+
+    AL_CONSTEXPR_CXX20 void reclaim_after_clear(const size_type len,
+                                                std::true_type) noexcept {
+        const auto target = static_cast<size_type>(growth_policy().on_clear(
+            len, capacity(), max_size(), sizeof(value_type)));
+        if (target >= capacity() or try_shrink_in_place(target) or
+            payload().fits(target, capacity())) {
+            return;
+        }
+        // Reclaiming is best effort, an empty list is fine if it fails.
+        deallocate_ptr();
+        payload() = Payload{};
+        try {
+            reserve(target);
+            payload().fit(target, capacity());
+        } catch (...) {
+        }
+    }
+
+    AL_CONSTEXPR_CXX20 void erase_range(pointer first, pointer last,
+                                        detail::RelocateByMove) {
+        auto& p = payload();
+        const auto new_end = std::move(last, p.current, first);
+        destroy_range(new_end, p.current);
+        p.current = new_end;
+        record_resize();
+    }
+
+    template <class Tag>
+    AL_CONSTEXPR_CXX20 void erase_range(pointer first, pointer last, Tag tag) {
+        auto& p = payload();
+        destroy_range(first, last);
+        detail::relocate_overlapping<AltyTraits>(last, p.current, first,
+                                                 get_allocator(), tag);
+        p.current -= last - first;
+        record_resize();
+    }
+
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 auto insert_range_at(const size_type index, Iter first,
+                                            Iter last, std::input_iterator_tag)
+        -> iterator {
+        // The length is unknown up front, append and rotate into place.
+        const auto old_size = size();
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(begin() + index, begin() + old_size, end());
+        return begin() + index;
+    }
+
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 auto insert_range_at(const size_type index, Iter first,
+                                            Iter last,
+                                            std::forward_iterator_tag)
+        -> iterator {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        return insert_with(index, count, [&](pointer dest) {
+            std::uninitialized_copy(first, last, dest);
+        });
+    }
+
+    /// Inserts `count` elements at `index`, built by `construct(dest)` into
+    /// uninitialized storage. The tail is shifted once, and the buffer grows
+    /// at most once.
+    template <typename Construct>
+    AL_CONSTEXPR_CXX20 auto insert_with(const size_type index,
+                                        const size_type count,
+                                        Construct construct) -> iterator {
+        if (count == 0) {
+            return begin() + index;
+        }
+        if (count > max_size() - size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        if (size() + count > capacity() and
+            !try_grow_in_place(calculate_growth(size() + count),
+                               size() + count)) {
+            return insert_reallocating(index, count, construct,
+                                       RelocationTag{});
+        }
+
+        auto& p = payload();
+        const auto gap = p.data + index;
+        detail::relocate_overlapping<AltyTraits>(gap, p.current, gap + count,
+                                                 get_allocator(),
+                                                 RelocationTag{});
+        try {
+            construct(gap);
+        } catch (...) {
+            detail::relocate_overlapping<AltyTraits>(
+                gap + count, p.current + count, gap, get_allocator(),
+                RelocationTag{});
+            throw;
+        }
+        p.current += count;
+        record_resize();
+        return gap;
+    }
+
+    template <typename Construct, class Tag>
+    AL_CONSTEXPR_CXX20 auto insert_reallocating(const size_type index,
+                                                const size_type count,
+                                                Construct& construct, Tag tag)
+        -> iterator {
+        const auto len = size();
+        const auto cap = capacity();
+        const auto block = allocate_storage(calculate_growth(len + count));
+        const auto new_data = block.ptr;
+        const auto new_capacity = block.count;
+
+        auto& p = payload();
+        try {
+            construct(new_data + index);
+        } catch (...) {
+            deallocate_target_ptr(new_data, new_capacity);
+            throw;
+        }
+        const auto had_buffer = p.data != nullptr;
+        if (had_buffer) {
+            detail::relocate_n<AltyTraits>(p.data, index, new_data,
+                                           get_allocator(), tag);
+            detail::relocate_n<AltyTraits>(p.data + index, len - index,
+                                           new_data + index + count,
+                                           get_allocator(), tag);
+            deallocate_target_ptr(p.data, cap);
+        }
+        p.data = new_data;
+        p.current = new_data + len + count;
+        p.end = new_data + new_capacity;
+        record_reallocation(had_buffer ? cap : 0, had_buffer ? len : 0);
+        return new_data + index;
+    }
+
+    template <typename Construct>
+    AL_CONSTEXPR_CXX20 auto insert_reallocating(const size_type index,
+                                                const size_type count,
+                                                Construct& construct,
+                                                detail::RelocateByRealloc)
+        -> iterator {
+        // realloc may extend in place, after which a memmove opens the gap.
+        reserve(calculate_growth(size() + count));
+        return insert_with(index, count, construct);
+    }
+
+    template <typename Construct>
+    AL_CONSTEXPR_CXX20 void resize_with(const size_type new_size,
+                                        Construct construct) {
+        const auto len = size();
+        auto& p = payload();
+
+        if (new_size < len) {
+            destroy_range(p.data + new_size, p.current);
+            p.current = p.data + new_size;
+            record_resize();
+            return;
+        }
+
+        reserve(new_size);
+        construct(p.current, new_size - len);
+        p.current = p.data + new_size;
+        record_resize();
+    }
+
+    AL_CONSTEXPR_CXX20 void reallocate(const size_type new_capacity) {
+        const auto cap = capacity();
+        const auto len = size();
+        const auto had_buffer = payload().data != nullptr;
+        reallocate_storage(new_capacity, RelocationTag{});
+        record_reallocation(had_buffer ? cap : 0, had_buffer ? len : 0);
+    }
+
+    AL_CONSTEXPR_CXX20 void record_reallocation(
+        const size_type old_capacity, const size_type relocated) noexcept {
+        if (capacity() == 0) {
+            return;
+        }
+        stats().on_reallocate(old_capacity, capacity(), relocated,
+                              sizeof(value_type));
+        record_resize();
+    }
+
+    AL_CONSTEXPR_CXX20 void record_resize() noexcept {
+        stats().on_resize(size(), capacity(), sizeof(value_type));
+    }
+
+    AL_CONSTEXPR_CXX20 auto try_extend_in_place(const size_type new_capacity)
+        -> bool {
+        auto& p = payload();
+        if (p.data == nullptr or
+            !detail::try_extend(get_allocator(), p.data, capacity(),
+                                new_capacity)) {
+            return false;
+        }
+        const auto cap = capacity();
+        p.end = p.data + new_capacity;
+        record_reallocation(cap, 0);
+        return true;
+    }
+
+    /// Extends to `new_capacity`, or failing that to `required`: an
+    /// allocator with a fixed extent is filled before the buffer moves.
+    AL_CONSTEXPR_CXX20 auto try_grow_in_place(const size_type new_capacity,
+                                              const size_type required)
+        -> bool {
+        return try_extend_in_place(new_capacity) or
+               (new_capacity > required and try_extend_in_place(required));
+    }
+
+    AL_CONSTEXPR_CXX20 auto try_shrink_in_place(
+        const size_type new_capacity) noexcept -> bool {
+        auto& p = payload();
+        if (p.data == nullptr or
+            !detail::try_shrink(get_allocator(), p.data, capacity(),
+                                new_capacity)) {
+            return false;
+        }
+        const auto cap = capacity();
+        p.end = p.data + new_capacity;
+        record_reallocation(cap, 0);
+        return true;
+    }
+
+    template <class Tag>
+    AL_CONSTEXPR_CXX20 void reallocate_storage(const size_type new_capacity,
+                                               Tag tag) {
+        const auto cap = capacity();
+        const auto len = size();
+
+        auto& p = payload();
+
+        const auto old_ptr = p.data;
+        raw_reserve(new_capacity);
+        if (old_ptr) {
+            detail::relocate_n<AltyTraits>(old_ptr, len, p.data,
+                                           get_allocator(), tag);
+            deallocate_target_ptr(old_ptr, cap);
+        }
+    }
+
+    AL_CONSTEXPR_CXX20 void reallocate_storage(const size_type new_capacity,
+                                               detail::RelocateByRealloc) {
+        const auto len = size();
+
+        auto& p = payload();
+
+        // realloc keeps the contents, and extends in place when it can.
+        void* const block = std::realloc(static_cast<void*>(p.data),
+                                         new_capacity * sizeof(value_type));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        p.data = static_cast<pointer>(block);
+        p.current = p.data + len;
+        p.end = p.data + new_capacity;
+    }
+
+    using Block = AllocationResult<pointer, size_type>;
+
+    /// Allocates room for at least `capacity` elements, and returns how many
+    /// fit.
+    AL_CONSTEXPR_CXX20 auto allocate_storage(const size_type capacity)
+        -> Block {
+        if (capacity == 0) {
+            return {nullptr, 0};
+        }
+        return allocate_storage(capacity, RelocationTag{});
+    }
+
+    template <class Tag>
+    AL_CONSTEXPR_CXX20 auto allocate_storage(const size_type capacity, Tag)
+        -> Block {
+        return detail::allocate_at_least<AltyTraits>(get_allocator(),
+                                                     capacity);
+    }
+
+    // realloc already grows into the slack of a block without copying, so
+    // these lists keep asking for exactly what they need.
+    AL_CONSTEXPR_CXX20 auto allocate_storage(const size_type capacity,
+                                             detail::RelocateByRealloc)
+        -> Block {
+        if (capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        void* const block = std::malloc(capacity * sizeof(value_type));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        return {static_cast<pointer>(block), capacity};
+    }
+
     AL_CONSTEXPR_CXX20 void raw_reserve(const size_type capacity) {
         const auto length = size();
-        payload().data = AltyTraits::allocate(get_allocator(), capacity);
+        const auto block = allocate_storage(capacity);
+        payload().data = block.ptr;
         payload().current = payload().data + length;
-        payload().end = payload().data + capacity;
+        payload().end = payload().data + block.count;
     }
 
-    AL_CONSTEXPR_CXX20 void copy_safe(const ArrayList& other) {
+    AL_CONSTEXPR_CXX20 void move_assign(ArrayList& other,
+                                        std::true_type) noexcept {
         destruct_all_elements();
         deallocate_ptr();
 
+        get_allocator() = std::move(other.get_allocator());
+        steal_payload(other);
+    }
+
+    AL_CONSTEXPR_CXX20 void move_assign(ArrayList& other, std::false_type) {
+        if (get_allocator() == other.get_allocator()) {
+            destruct_all_elements();
+            deallocate_ptr();
+
+            steal_payload(other);
+            return;
+        }
+
+        // Memory from another allocator can't be adopted, move the elements.
+        // The buffer is kept for them rather than reclaimed as clear() may.
+        destruct_all_elements();
+        auto& p = payload();
+        p.current = p.data;
         reserve(other.size());
-        copy_unsafe(other);
+        p.current = std::uninitialized_move(other.begin(), other.end(), p.data);
+        record_resize();
+        other.clear();
     }
 
-    AL_CONSTEXPR_CXX20 void copy_unsafe(const ArrayList& other) {
-        const auto length{other.size()};
-        payload().current = payload().data + length;
-        std::uninitialized_copy_n(other.payload().data, length, payload().data);
+    AL_CONSTEXPR_CXX20 void steal_payload(ArrayList& other) noexcept {
+        growth_policy() = std::move(other.growth_policy());
+        stats() = std::move(other.stats());
+        payload() = other.payload();
+        other.payload() = Payload{};
+    }
+
+    AL_CONSTEXPR_CXX20 void copy_safe(const ArrayList& other) {
+        copy_allocator(
+            other,
+            typename AltyTraits::propagate_on_container_copy_assignment{});
+        assign_counted(other.payload().data, other.size());
+    }
+
+    AL_CONSTEXPR_CXX20 void copy_allocator(const ArrayList& other,
+                                           std::true_type) {
+        if (get_allocator() != other.get_allocator()) {
+            // The buffer has to go back to the allocator that made it.
+            destruct_all_elements();
+            deallocate_ptr();
+            payload() = Payload{};
+        }
+        get_allocator() = other.get_allocator();
+    }
+
+    AL_CONSTEXPR_CXX20 void copy_allocator(const ArrayList& /* other */,
+                                           std::false_type) noexcept {}
+
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 void assign_from(Iter first, Iter last,
+                                        std::input_iterator_tag) {
+        auto& p = payload();
+        auto dest = p.data;
+        for (; dest != p.current and first != last; ++dest, ++first) {
+            *dest = *first;
+        }
+        if (dest != p.current) {
+            destroy_range(dest, p.current);
+            p.current = dest;
+            record_resize();
+            return;
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        record_resize();
+    }
+
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 void assign_from(Iter first, Iter last,
+                                        std::forward_iterator_tag) {
+        assign_counted(first,
+                       static_cast<size_type>(std::distance(first, last)));
+    }
+
+    /// Assigns the `count` elements starting at `first` over the live ones,
+    /// constructing or destroying only the difference.
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 void assign_counted(Iter first, const size_type count) {
+        if (count > capacity()) {
+            replace_storage(count, [&](pointer dest) {
+                std::uninitialized_copy_n(first, count, dest);
+            });
+            return;
+        }
+
+        auto& p = payload();
+        const auto len = size();
+        auto dest = p.data;
+        for (const auto assigned = p.data + (count < len ? count : len);
+             dest != assigned; ++dest, ++first) {
+            *dest = *first;
+        }
+        if (count > len) {
+            p.current =
+                std::uninitialized_copy_n(first, count - len, p.current);
+        } else {
+            destroy_range(dest, p.current);
+            p.current = dest;
+        }
+        record_resize();
+    }
+
+    /// Builds `count` elements into a new buffer sized for them with
+    /// `construct(dest)`, then drops the old one. The source may alias the
+    /// current elements.
+    template <typename Construct>
+    AL_CONSTEXPR_CXX20 void replace_storage(const size_type count,
+                                            Construct construct) {
+        if (count > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        const auto cap = capacity();
+        const auto block = allocate_storage(count);
+        const auto new_data = block.ptr;
+        try {
+            construct(new_data);
+        } catch (...) {
+            deallocate_target_ptr(new_data, block.count);
+            throw;
+        }
+        destruct_all_elements();
+        deallocate_ptr();
+
+        auto& p = payload();
+        p.data = new_data;
+        p.current = new_data + count;
+        p.end = new_data + block.count;
+        record_reallocation(cap, 0);
+    }
+
+    /// Fills an empty list being constructed. Forward ranges are counted so
+    /// the buffer is allocated exactly once.
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 void construct_from_range(Iter first, Iter last,
+                                                 std::input_iterator_tag) {
+        try {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            destruct_all_elements();
+            deallocate_ptr();
+            throw;
+        }
+    }
+
+    template <class Iter>
+    AL_CONSTEXPR_CXX20 void construct_from_range(Iter first, Iter last,
+                                                 std::forward_iterator_tag) {
+        reserve(static_cast<size_type>(std::distance(first, last)));
+        auto& p = payload();
+        try {
+            p.current = std::uninitialized_copy(first, last, p.data);
+        } catch (...) {
+            deallocate_ptr();
+            throw;
+        }
+        record_resize();
     }
 
     constexpr void ensure_in_range(const size_type index) const {
@@ -716,9 +1846,16 @@ class ArrayList {
     }
 
     AL_CONSTEXPR_CXX20 void ensure_size_for_elements(const size_type elements) {
-        if (!(size() + elements <= capacity())) {
-            auto new_capacity = calculate_growth(capacity() + elements);
-            reserve(new_capacity);
+        const auto required = size() + elements;
+        if (required <= capacity()) {
+            return;
+        }
+        const auto new_capacity = calculate_growth(required);
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        if (!try_grow_in_place(new_capacity, required)) {
+            reallocate(new_capacity);
         }
     }
 
@@ -728,15 +1865,19 @@ class ArrayList {
 
     template <typename... Args>
     AL_CONSTEXPR_CXX20 auto raw_emplace_back(Args&&... args) -> value_type& {
-        return emplace_at_back(std::forward<Args>(args)...);
+        auto& value = emplace_at_back(std::forward<Args>(args)...);
+        record_resize();
+        return value;
     }
 
     AL_CONSTEXPR_CXX20 auto raw_push_back(const Type& value) -> void {
         push_at_back(value);
+        record_resize();
     }
 
     AL_CONSTEXPR_CXX20 auto raw_push_back(Type&& value) -> void {
         push_at_back(std::move(value));
+        record_resize();
     }
 
     template <typename... Args>
@@ -771,7 +1912,6 @@ class ArrayList {
     }
 
     AL_CONSTEXPR_CXX20 auto destroy_in_place(Type* value) noexcept -> void {
-        AltyTraits::destroy(get_allocator(), value);
         detail::destroy_in_place<AltyTraits>(value, get_allocator());
     }
 
@@ -789,10 +1929,25 @@ class ArrayList {
     AL_CONSTEXPR_CXX20 auto deallocate_target_ptr(
         value_type* const ptr, const size_type length) -> void {
         if (ptr) {
-            AltyTraits::deallocate(get_allocator(), ptr, length);
+            deallocate_storage(ptr, length, RelocationTag{});
+            stats().on_deallocate(length, sizeof(value_type));
         }
     }
 
+    template <class Tag>
+    AL_CONSTEXPR_CXX20 auto deallocate_storage(value_type* const ptr,
+                                               const size_type length, Tag)
+        -> void {
+        AltyTraits::deallocate(get_allocator(), ptr, length);
+    }
+
+    AL_CONSTEXPR_CXX20 auto deallocate_storage(value_type* const ptr,
+                                               const size_type /* length */,
+                                               detail::RelocateByRealloc)
+        -> void {
+        std::free(static_cast<void*>(ptr));
+    }
+
     AL_CONSTEXPR_CXX20 auto deallocate_ptr() -> void {
         deallocate_target_ptr(data(), capacity());
     }
@@ -802,7 +1957,8 @@ class ArrayList {
         swap(compressed_, other.compressed_);
     }
 
-    struct Payload {
+    struct Payload
+        : detail::FittedBlock<size_type, ReceivesSlack> {
         constexpr Payload() = default;
 
         constexpr explicit Payload(pointer data, pointer end, pointer current)
@@ -819,18 +1975,47 @@ class ArrayList {
     };
 
     constexpr auto payload() noexcept -> Payload& {
-        return compressed_.get_second();
+        return compressed_.get_second().get_second().get_second();
     }
 
     constexpr auto payload() const noexcept -> const Payload& {
-        return compressed_.get_second();
+        return compressed_.get_second().get_second().get_second();
     }
 
-    using Compressed = detail::CompressedPair<allocator_type, Payload>;
+    using Compressed = detail::CompressedPair<
+        allocator_type,
+        detail::CompressedPair<
+            growth_policy_type,
+            detail::CompressedPair<stats_policy_type, Payload>>>;
 
     Compressed compressed_;
 };
 
+/// Removes every element matching `predicate` in a single pass, and returns
+/// how many were removed.
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, typename Predicate>
+AL_CONSTEXPR_CXX20 auto erase_if(
+    ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+    Predicate predicate) ->
+    typename ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>::size_type {
+    const auto new_end = std::remove_if(list.begin(), list.end(), predicate);
+    const auto removed = list.end() - new_end;
+    list.erase(new_end, list.end());
+    return static_cast<typename ArrayList<Type, Allocator, GrowthPolicy,
+                                          StatsPolicy>::size_type>(removed);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, typename Value>
+AL_CONSTEXPR_CXX20 auto erase(
+    ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+    const Value& value) ->
+    typename ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>::size_type {
+    return erase_if(list,
+                    [&value](const Type& element) { return element == value; });
+}
+
 }  // namespace al
 
 #endif  // ARRAY_LIST_HPP
@@ -0,0 +1,239 @@
+#ifndef ARRAY_LIST_STATS_HPP
+#define ARRAY_LIST_STATS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+
+#include "array_list.hpp"
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace al {
+
+/// Counters describing the buffers of one ArrayList, or the totals of every
+/// ArrayList recording under the same tag. Capacities are in elements.
+struct ArrayListStatsSnapshot {
+    std::uint64_t allocations = 0;
+    std::uint64_t reallocations = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t elements_relocated = 0;
+    std::uint64_t bytes_relocated = 0;
+    std::uint64_t peak_capacity = 0;
+    /// Unused capacity in bytes. For an instance this is the latest value,
+    /// for a tag the largest value seen by any instance.
+    std::uint64_t wasted_bytes = 0;
+};
+
+namespace detail {
+
+inline auto demangle(const char* const name) -> std::string {
+#if defined(__GNUG__)
+    int status = 0;
+    char* const demangled =
+        abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (status == 0 and demangled != nullptr) {
+        std::string result(demangled);
+        std::free(demangled);  // NOLINT
+        return result;
+    }
+#endif
+    return name;
+}
+
+struct StatsAggregate {
+    static void raise(std::atomic<std::uint64_t>& peak,
+                      const std::uint64_t value) noexcept {
+        auto current = peak.load(std::memory_order_relaxed);
+        while (current < value and
+               !peak.compare_exchange_weak(current, value,
+                                           std::memory_order_relaxed)) {
+        }
+    }
+
+    auto snapshot() const noexcept -> ArrayListStatsSnapshot {
+        ArrayListStatsSnapshot result;
+        result.allocations = allocations.load(std::memory_order_relaxed);
+        result.reallocations = reallocations.load(std::memory_order_relaxed);
+        result.deallocations = deallocations.load(std::memory_order_relaxed);
+        result.elements_relocated =
+            elements_relocated.load(std::memory_order_relaxed);
+        result.bytes_relocated =
+            bytes_relocated.load(std::memory_order_relaxed);
+        result.peak_capacity = peak_capacity.load(std::memory_order_relaxed);
+        result.wasted_bytes = wasted_bytes.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    void reset() noexcept {
+        allocations = 0;
+        reallocations = 0;
+        deallocations = 0;
+        elements_relocated = 0;
+        bytes_relocated = 0;
+        peak_capacity = 0;
+        wasted_bytes = 0;
+    }
+
+    std::atomic<std::uint64_t> allocations{0};
+    std::atomic<std::uint64_t> reallocations{0};
+    std::atomic<std::uint64_t> deallocations{0};
+    std::atomic<std::uint64_t> elements_relocated{0};
+    std::atomic<std::uint64_t> bytes_relocated{0};
+    std::atomic<std::uint64_t> peak_capacity{0};
+    std::atomic<std::uint64_t> wasted_bytes{0};
+};
+
+/// Process-wide aggregates, one per tag type. Entries are never removed, so
+/// references to them stay valid for the lifetime of the program.
+class StatsRegistry {
+   public:
+    static auto instance() -> StatsRegistry& {
+        static StatsRegistry registry;
+        return registry;
+    }
+
+    auto get(const std::type_info& tag) -> StatsAggregate& {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        auto& entry = entries_[std::type_index(tag)];
+        if (entry.name.empty()) {
+            entry.name = demangle(tag.name());
+        }
+        return entry.aggregate;
+    }
+
+    template <class Function>
+    void for_each(Function function) const {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : entries_) {
+            function(entry.second.name, entry.second.aggregate.snapshot());
+        }
+    }
+
+    void reset() noexcept {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& entry : entries_) {
+            entry.second.aggregate.reset();
+        }
+    }
+
+   private:
+    struct Entry {
+        std::string name;
+        StatsAggregate aggregate;
+    };
+
+    mutable std::mutex mutex_;
+    std::map<std::type_index, Entry> entries_;
+};
+
+template <class Tag>
+auto aggregate_for() -> StatsAggregate& {
+    static auto& aggregate = StatsRegistry::instance().get(typeid(Tag));
+    return aggregate;
+}
+
+}  // namespace detail
+
+/// Stats policy recording every buffer change of an ArrayList, both in the
+/// instance and in the process-wide totals for `Tag`.
+template <class Tag>
+class ArrayListStats {
+   public:
+    void on_reallocate(const size_t old_capacity, const size_t new_capacity,
+                       const size_t relocated,
+                       const size_t element_size) noexcept {
+        auto& aggregate = detail::aggregate_for<Tag>();
+        if (old_capacity == 0) {
+            ++local_.allocations;
+            aggregate.allocations.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            ++local_.reallocations;
+            aggregate.reallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        local_.elements_relocated += relocated;
+        local_.bytes_relocated += relocated * element_size;
+        aggregate.elements_relocated.fetch_add(relocated,
+                                               std::memory_order_relaxed);
+        aggregate.bytes_relocated.fetch_add(relocated * element_size,
+                                            std::memory_order_relaxed);
+
+        if (new_capacity > local_.peak_capacity) {
+            local_.peak_capacity = new_capacity;
+        }
+        detail::StatsAggregate::raise(aggregate.peak_capacity, new_capacity);
+        // The list follows up with `on_resize`, which knows its size.
+    }
+
+    void on_deallocate(const size_t /* capacity */,
+                       const size_t /* element_size */) noexcept {
+        ++local_.deallocations;
+        local_.wasted_bytes = 0;
+        detail::aggregate_for<Tag>().deallocations.fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
+    void on_resize(const size_t size, const size_t capacity,
+                   const size_t element_size) noexcept {
+        record_waste(size, capacity, element_size,
+                     detail::aggregate_for<Tag>());
+    }
+
+    AL_NODISCARD auto snapshot() const noexcept
+        -> const ArrayListStatsSnapshot& {
+        return local_;
+    }
+
+   private:
+    void record_waste(const size_t size, const size_t capacity,
+                      const size_t element_size,
+                      detail::StatsAggregate& aggregate) noexcept {
+        local_.wasted_bytes = (capacity - size) * element_size;
+        detail::StatsAggregate::raise(aggregate.wasted_bytes,
+                                      local_.wasted_bytes);
+    }
+
+    ArrayListStatsSnapshot local_;
+};
+
+/// An ArrayList recording its stats under `Tag`, by default its element type.
+template <typename Type, typename Tag = Type,
+          typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = GeometricGrowth<>>
+using TrackedArrayList =
+    ArrayList<Type, Allocator, GrowthPolicy, ArrayListStats<Tag>>;
+
+/// The process-wide totals recorded under `Tag`.
+template <class Tag>
+auto array_list_stats() -> ArrayListStatsSnapshot {
+    return detail::aggregate_for<Tag>().snapshot();
+}
+
+inline void reset_array_list_stats() noexcept {
+    detail::StatsRegistry::instance().reset();
+}
+
+/// Writes one line of totals per tag.
+inline void dump_array_list_stats(std::ostream& out) {
+    detail::StatsRegistry::instance().for_each(
+        [&out](const std::string& name, const ArrayListStatsSnapshot& stats) {
+            out << name << ": allocations=" << stats.allocations
+                << " reallocations=" << stats.reallocations
+                << " deallocations=" << stats.deallocations
+                << " elements_relocated=" << stats.elements_relocated
+                << " bytes_relocated=" << stats.bytes_relocated
+                << " peak_capacity=" << stats.peak_capacity
+                << " wasted_bytes=" << stats.wasted_bytes << '\n';
+        });
+}
+
+}  // namespace al
+
+#endif  // ARRAY_LIST_STATS_HPP
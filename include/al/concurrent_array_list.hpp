@@ -0,0 +1,438 @@
+#ifndef CONCURRENT_ARRAY_LIST_HPP
+#define CONCURRENT_ARRAY_LIST_HPP
+
+#include <atomic>
+#include <mutex>
+
+#include "array_list.hpp"
+#include "detail/segments.hpp"
+
+namespace al {
+
+/// A list that many threads can append to at once. Appends claim slots with
+/// a single atomic fetch-add and never relocate: the list grows by adding
+/// segments twice the size of the last, so references to elements stay
+/// valid and reading an element never blocks.
+///
+/// `size()` counts claimed slots, and an element is constructed by the time
+/// the append that claimed it returns. Read only elements whose append you
+/// have synchronized with, such as those appended by the same thread or by
+/// producers that have been joined. Everything else (copying, `clear`,
+/// `freeze`, destruction) must not race with appends.
+///
+/// The allocator is called concurrently, so it must be thread-safe. If it
+/// throws, the slots claimed by that append stay empty and are skipped.
+/// They are recorded without allocating, in room for `MaxHoles` failed
+/// appends; past that the closest two records are merged, and the elements
+/// between them are dropped without being destroyed.
+template <typename Type, typename Allocator = std::allocator<Type>>
+AL_REQUIRES(std::is_object<Type>::value)
+class ConcurrentArrayList {
+    static_assert(
+        std::is_same<Type, typename Allocator::value_type>::value,
+        "Requires allocator's type to match the type held by the ArrayList");
+    static_assert(std::is_object<Type>::value,
+                  "Requires type held by the ArrayList to be an object");
+    // Elements are built before their slot is claimed and moved in, so a
+    // throwing constructor never leaves a claimed slot empty.
+    static_assert(std::is_nothrow_move_constructible<Type>::value,
+                  "Requires a type that can be moved without throwing");
+
+    // NOLINTBEGIN
+    using Alty =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Type>;
+    using AltyTraits = std::allocator_traits<Alty>;
+
+   public:
+    using value_type = Type;
+    using allocator_type = Alty;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using size_type = typename AltyTraits::size_type;
+    using difference_type = typename AltyTraits::difference_type;
+    // NOLINTEND
+
+    static_assert(
+        std::is_same<typename AltyTraits::pointer, pointer>::value,
+        "Requires an allocator handing out raw pointers");
+
+    /// The number of elements in the first segment.
+    static constexpr size_type FirstSegmentSize = 32;
+
+    /// The number of failed appends recorded exactly.
+    static constexpr size_type MaxHoles = 16;
+
+    ConcurrentArrayList() noexcept = default;
+
+    explicit ConcurrentArrayList(const allocator_type& alloc) noexcept
+        : allocator_(alloc) {}
+
+    ConcurrentArrayList(const ConcurrentArrayList&) = delete;
+    auto operator=(const ConcurrentArrayList&) -> ConcurrentArrayList& = delete;
+
+    ~ConcurrentArrayList() {
+        clear();
+        release_segments();
+    }
+
+    AL_NODISCARD auto size() const noexcept -> size_type {
+        return claimed_.load(std::memory_order_acquire);
+    }
+
+    AL_NODISCARD auto empty() const noexcept -> bool { return size() == 0; }
+
+    static constexpr auto max_size() noexcept -> size_type {
+        return static_cast<size_type>(-1) / sizeof(value_type) / 2;
+    }
+
+    AL_NODISCARD auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    auto push_back(const Type& value) -> reference {
+        return emplace_back(value);
+    }
+
+    auto push_back(Type&& value) -> reference {
+        return emplace_back(std::move(value));
+    }
+
+    /// Appends an element and returns a reference to it, which stays valid
+    /// until the list is cleared, frozen or destroyed.
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> reference {
+        return emplace_back_impl(
+            std::is_nothrow_constructible<Type, Args&&...>{},
+            std::forward<Args>(args)...);
+    }
+
+    /// Appends `count` copies of `value` with a single claim, so they are
+    /// contiguous in index order. Returns the index of the first.
+    auto append(const size_type count, const Type& value) -> size_type {
+        return append_copies(count, value,
+                             std::is_nothrow_copy_constructible<Type>{});
+    }
+
+    /// Appends `[first, last)` with a single claim, so the elements are
+    /// contiguous in index order. Returns the index of the first.
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    auto append(Iter first, Iter last,
+                typename std::enable_if<detail::IsIteratorV<Iter>,
+                                        std::true_type>::type /* */
+                = {}) -> size_type {
+        return append_range(first, last, detail::IterConcatenateType<Iter>{});
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) noexcept -> reference {
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) const noexcept
+        -> const_reference {
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) -> reference {
+        ensure_in_range(index);
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) const -> const_reference {
+        ensure_in_range(index);
+        return *slot(index);
+    }
+
+    /// Calls `function(element)` for every element in index order, a
+    /// segment at a time.
+    template <class Function>
+    void for_each(Function function) const {
+        visit(size(), [&function](const_pointer first, const size_type count) {
+            for (size_type i = 0; i < count; ++i) {
+                function(first[i]);
+            }
+        });
+    }
+
+    /// Destroys every element, keeping the segments for reuse.
+    void clear() noexcept {
+        visit(size(), [this](pointer first, const size_type count) {
+            detail::destruct_all_elements<AltyTraits>(first, first + count,
+                                                      allocator_);
+        });
+        claimed_.store(0, std::memory_order_release);
+        hole_count_ = 0;
+    }
+
+    /// Moves every element into one contiguous ArrayList, leaving this list
+    /// empty and without segments. Call it once the producers are done.
+    template <typename GrowthPolicy = GeometricGrowth<>>
+    auto freeze() -> ArrayList<Type, Allocator, GrowthPolicy> {
+        ArrayList<Type, Allocator, GrowthPolicy> result(allocator_);
+        const auto count = size();
+        const auto elements = live(count);
+        result.append_with(elements, [this, count, elements](pointer out,
+                                                             size_type) {
+            visit(count, [this, &out](pointer first, const size_type run) {
+                detail::relocate_n<AltyTraits>(first, run, out, allocator_,
+                                               RelocationTag{});
+                out += run;
+            });
+            return elements;
+        });
+        claimed_.store(0, std::memory_order_release);
+        hole_count_ = 0;
+        release_segments();
+        return result;
+    }
+
+    /// Allocates the segments needed to hold `new_capacity` elements, so
+    /// appends up to there never allocate.
+    void reserve(const size_type new_capacity) {
+        if (new_capacity == 0) {
+            return;
+        }
+        ensure_segments(0, Segments::segment_of(new_capacity - 1));
+    }
+
+   private:
+    using Segments = detail::Segments<FirstSegmentSize>;
+    using Hole = std::pair<size_type, size_type>;
+    using RelocationTag =
+        typename std::conditional<IsTriviallyRelocatable<Type>::value,
+                                  detail::RelocateByMemcpy,
+                                  detail::RelocateByMove>::type;
+
+    template <typename... Args>
+    auto emplace_back_impl(std::true_type /* nothrow */, Args&&... args)
+        -> reference {
+        const auto index = claim(1);
+        auto* const target = slot(index);
+        AltyTraits::construct(allocator_, target, std::forward<Args>(args)...);
+        return *target;
+    }
+
+    template <typename... Args>
+    auto emplace_back_impl(std::false_type /* nothrow */, Args&&... args)
+        -> reference {
+        value_type tmp(std::forward<Args>(args)...);
+        return emplace_back_impl(std::true_type{}, std::move(tmp));
+    }
+
+    auto append_copies(const size_type count, const Type& value,
+                       std::true_type /* nothrow */) -> size_type {
+        const auto start = claim(count);
+        visit_range(start, count, [this, &value](pointer first, size_type run) {
+            for (size_type i = 0; i < run; ++i) {
+                AltyTraits::construct(allocator_, first + i, value);
+            }
+        });
+        return start;
+    }
+
+    auto append_copies(const size_type count, const Type& value,
+                       std::false_type /* nothrow */) -> size_type {
+        ArrayList<Type, Allocator> copies(allocator_);
+        copies.reserve(count);
+        for (size_type i = 0; i < count; ++i) {
+            copies.push_back(value);
+        }
+        return append_moved(copies);
+    }
+
+    template <typename Iter>
+    auto append_range(Iter first, Iter last, std::forward_iterator_tag)
+        -> size_type {
+        using Nothrow = std::is_nothrow_constructible<Type, decltype(*first)>;
+        if (not Nothrow::value) {
+            ArrayList<Type, Allocator> copies(first, last, allocator_);
+            return append_moved(copies);
+        }
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        const auto start = claim(count);
+        visit_range(start, count, [this, &first](pointer out, size_type run) {
+            for (size_type i = 0; i < run; ++i, ++first) {
+                AltyTraits::construct(allocator_, out + i, *first);
+            }
+        });
+        return start;
+    }
+
+    /// Input ranges cannot be counted up front, so they are collected first.
+    template <typename Iter>
+    auto append_range(Iter first, Iter last, std::input_iterator_tag)
+        -> size_type {
+        ArrayList<Type, Allocator> copies(first, last, allocator_);
+        return append_moved(copies);
+    }
+
+    auto append_moved(ArrayList<Type, Allocator>& elements) -> size_type {
+        return append_range(std::make_move_iterator(elements.begin()),
+                            std::make_move_iterator(elements.end()),
+                            std::forward_iterator_tag{});
+    }
+
+    /// Claims `count` slots and makes sure their segments exist.
+    auto claim(const size_type count) -> size_type {
+        if (count > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        const auto start = claimed_.fetch_add(count, std::memory_order_acq_rel);
+        if (count == 0) {
+            return start;
+        }
+        try {
+            ensure_segments(Segments::segment_of(start),
+                            Segments::segment_of(start + count - 1));
+        } catch (...) {
+            // The slots are claimed for good, so remember to skip them.
+            record_hole(start, count);
+            throw;
+        }
+        return start;
+    }
+
+    /// Adds [start, start + count) to the sorted holes. Memory has just run
+    /// out, so this must not allocate: when the table is full, the two
+    /// holes with the fewest slots between them become one.
+    void record_hole(const size_type start, const size_type count) noexcept {
+        const std::lock_guard<std::mutex> lock(holes_mutex_);
+        Hole holes[MaxHoles + 1];
+        auto total = hole_count_;
+        std::copy(holes_, holes_ + total, holes);
+        const Hole hole{start, count};
+        const auto position = std::upper_bound(holes, holes + total, hole);
+        std::copy_backward(position, holes + total, holes + total + 1);
+        *position = hole;
+        ++total;
+
+        if (total > MaxHoles) {
+            size_type closest = 0;
+            for (size_type index = 1; index + 1 < total; ++index) {
+                if (gap_after(holes, index) < gap_after(holes, closest)) {
+                    closest = index;
+                }
+            }
+            const auto& next = holes[closest + 1];
+            holes[closest].second =
+                next.first + next.second - holes[closest].first;
+            std::copy(holes + closest + 2, holes + total, holes + closest + 1);
+            --total;
+        }
+        std::copy(holes, holes + total, holes_);
+        hole_count_ = total;
+    }
+
+    static auto gap_after(const Hole* const holes,
+                          const size_type index) noexcept -> size_type {
+        return holes[index + 1].first -
+               (holes[index].first + holes[index].second);
+    }
+
+    /// Allocates the missing segments in [first, last). A thread that loses
+    /// the race to install a segment frees its own and uses the winner's.
+    void ensure_segments(const size_type first, const size_type last) {
+        for (auto segment = first; segment <= last; ++segment) {
+            auto& entry = segments_[segment];
+            if (entry.load(std::memory_order_acquire) != nullptr) {
+                continue;
+            }
+            const auto size = Segments::size_of(segment);
+            pointer fresh = AltyTraits::allocate(allocator_, size);
+            pointer expected = nullptr;
+            if (not entry.compare_exchange_strong(expected, fresh,
+                                                  std::memory_order_acq_rel)) {
+                AltyTraits::deallocate(allocator_, fresh, size);
+            }
+        }
+    }
+
+    auto slot(const size_type index) const noexcept -> pointer {
+        const auto segment = Segments::segment_of(index);
+        return segments_[segment].load(std::memory_order_acquire) +
+               (index - Segments::start_of(segment));
+    }
+
+    /// Calls `function(first, count)` for the contiguous runs of elements
+    /// [start, start + count), one per segment.
+    template <class Function>
+    void visit_range(size_type start, size_type count,
+                     Function function) const {
+        while (count > 0) {
+            const auto segment = Segments::segment_of(start);
+            const auto offset = start - Segments::start_of(segment);
+            const auto run =
+                std::min(count, Segments::size_of(segment) - offset);
+            function(
+                segments_[segment].load(std::memory_order_acquire) + offset,
+                run);
+            start += run;
+            count -= run;
+        }
+    }
+
+    /// Like `visit_range` over [0, count), skipping holes.
+    template <class Function>
+    void visit(const size_type count, Function function) const {
+        size_type start = 0;
+        for (size_type index = 0; index < hole_count_; ++index) {
+            const auto& hole = holes_[index];
+            if (hole.first >= count) {
+                break;
+            }
+            visit_range(start, hole.first - start, function);
+            start = hole.first + hole.second;
+        }
+        if (start < count) {
+            visit_range(start, count - start, function);
+        }
+    }
+
+    /// The number of elements among the first `count` slots.
+    auto live(const size_type count) const noexcept -> size_type {
+        auto result = count;
+        for (size_type index = 0; index < hole_count_; ++index) {
+            const auto& hole = holes_[index];
+            if (hole.first < count) {
+                result -= std::min(hole.second, count - hole.first);
+            }
+        }
+        return result;
+    }
+
+    void release_segments() noexcept {
+        for (size_type segment = 0; segment < Segments::Count; ++segment) {
+            const auto data = segments_[segment].exchange(nullptr);
+            if (data != nullptr) {
+                AltyTraits::deallocate(allocator_, data,
+                                       Segments::size_of(segment));
+            }
+        }
+    }
+
+    void ensure_in_range(const size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    Alty allocator_;
+    std::atomic<size_type> claimed_{0};
+    std::atomic<pointer> segments_[Segments::Count] = {};
+    // Slots claimed by appends that failed to allocate their segment, as
+    // sorted (start, count) pairs. They count towards `size()` but hold no
+    // element, and only happen once memory runs out.
+    std::mutex holes_mutex_;
+    Hole holes_[MaxHoles] = {};
+    size_type hole_count_ = 0;
+};
+
+}  // namespace al
+
+#endif  // CONCURRENT_ARRAY_LIST_HPP
@@ -0,0 +1,213 @@
+#ifndef AL_DETAIL_IO_HPP
+#define AL_DETAIL_IO_HPP
+
+#include <cerrno>
+#include <cstdio>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <system_error>
+
+#include "../array_list.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define AL_HAS_POSIX_IO 1
+#else
+#define AL_HAS_POSIX_IO 0
+#endif
+
+namespace al {
+
+#if AL_HAS_POSIX_IO
+/// A POSIX file descriptor, wrapped so it cannot be taken for a count.
+struct FileDescriptor {
+    int fd;
+};
+#endif
+
+namespace detail {
+
+struct ByteSpan {
+    const void* data;
+    size_t size;
+};
+
+/// Writes every span in order. Streams report failure through
+/// `std::ios_base::failure`, files and descriptors through
+/// `std::system_error`.
+template <size_t Count>
+void write_all(std::ostream& out, const ByteSpan (&spans)[Count]) {
+    for (size_t index = 0; index < Count; ++index) {
+        out.write(static_cast<const char*>(spans[index].data),
+                  static_cast<std::streamsize>(spans[index].size));
+    }
+    if (!out) {
+        throw std::ios_base::failure("Cannot write to stream");
+    }
+}
+
+template <size_t Count>
+void write_all(std::FILE* const file, const ByteSpan (&spans)[Count]) {
+    for (size_t index = 0; index < Count; ++index) {
+        // An empty list has no data pointer to hand to fwrite.
+        if (spans[index].size != 0 and
+            std::fwrite(spans[index].data, 1, spans[index].size, file) !=
+                spans[index].size) {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Cannot write to file");
+        }
+    }
+}
+
+#if AL_HAS_POSIX_IO
+/// Hands every span to the kernel in one `writev`, looping only on short
+/// writes.
+template <size_t Count>
+void write_all(const FileDescriptor file, const ByteSpan (&spans)[Count]) {
+    ::iovec vectors[Count];
+    size_t pending = 0;
+    for (size_t index = 0; index < Count; ++index) {
+        if (spans[index].size != 0) {
+            vectors[pending++] = {const_cast<void*>(spans[index].data),
+                                  spans[index].size};
+        }
+    }
+    auto* next = vectors;
+    while (pending != 0) {
+        const auto written =
+            ::writev(file.fd, next, static_cast<int>(pending));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(),
+                                    "Cannot write to file descriptor");
+        }
+        auto remaining = static_cast<size_t>(written);
+        while (pending != 0 and remaining >= next->iov_len) {
+            remaining -= next->iov_len;
+            ++next;
+            --pending;
+        }
+        if (pending != 0) {
+            next->iov_base = static_cast<char*>(next->iov_base) + remaining;
+            next->iov_len -= remaining;
+        }
+    }
+}
+#endif
+
+/// Reads until `bytes` have arrived or the input ends, and returns how many
+/// arrived.
+inline auto read_up_to(std::istream& in, void* const data, const size_t bytes)
+    -> size_t {
+    in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+    if (in.bad()) {
+        throw std::ios_base::failure("Cannot read from stream");
+    }
+    return static_cast<size_t>(in.gcount());
+}
+
+inline auto read_up_to(std::FILE* const file, void* const data,
+                       const size_t bytes) -> size_t {
+    const auto read = std::fread(data, 1, bytes, file);
+    if (read != bytes and std::ferror(file) != 0) {
+        throw std::system_error(errno, std::generic_category(),
+                                "Cannot read from file");
+    }
+    return read;
+}
+
+#if AL_HAS_POSIX_IO
+inline auto read_up_to(const FileDescriptor file, void* const data,
+                       const size_t bytes) -> size_t {
+    size_t total = 0;
+    while (total < bytes) {
+        const auto read =
+            ::read(file.fd, static_cast<char*>(data) + total, bytes - total);
+        if (read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(),
+                                    "Cannot read from file descriptor");
+        }
+        if (read == 0) {
+            break;
+        }
+        total += static_cast<size_t>(read);
+    }
+    return total;
+}
+#endif
+
+/// The bytes left between the read position and the end of a seekable
+/// input, or nothing for pipes, sockets and terminals.
+inline auto remaining_size(std::istream& in) -> std::optional<size_t> {
+    auto* const buffer = in.rdbuf();
+    if (buffer == nullptr or not in) {
+        return std::nullopt;
+    }
+    const auto here =
+        buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+    if (here == std::streampos(-1)) {
+        return std::nullopt;
+    }
+    const auto end =
+        buffer->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+    buffer->pubseekpos(here, std::ios_base::in);
+    if (end == std::streampos(-1) or end < here) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(end - here);
+}
+
+#if AL_HAS_POSIX_IO
+inline auto remaining_size(const FileDescriptor file)
+    -> std::optional<size_t> {
+    struct ::stat status {};
+    if (::fstat(file.fd, &status) != 0 or not S_ISREG(status.st_mode)) {
+        return std::nullopt;
+    }
+    const auto here = ::lseek(file.fd, 0, SEEK_CUR);
+    if (here < 0 or here > status.st_size) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(status.st_size - here);
+}
+#endif
+
+inline auto remaining_size(std::FILE* const file) -> std::optional<size_t> {
+#if AL_HAS_POSIX_IO
+    struct ::stat status {};
+    if (::fstat(::fileno(file), &status) != 0 or
+        not S_ISREG(status.st_mode)) {
+        return std::nullopt;
+    }
+    const auto here = ::ftello(file);
+    if (here < 0 or here > status.st_size) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(status.st_size - here);
+#else
+    const auto here = std::ftell(file);
+    if (here < 0 or std::fseek(file, 0, SEEK_END) != 0) {
+        return std::nullopt;
+    }
+    const auto end = std::ftell(file);
+    std::fseek(file, here, SEEK_SET);
+    if (end < here) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(end - here);
+#endif
+}
+
+}  // namespace detail
+
+}  // namespace al
+
+#endif  // AL_DETAIL_IO_HPP
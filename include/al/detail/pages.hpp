@@ -0,0 +1,39 @@
+#ifndef AL_DETAIL_PAGES_HPP
+#define AL_DETAIL_PAGES_HPP
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "Page mappings require POSIX mmap"
+#endif
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <system_error>
+
+#include "../array_list.hpp"
+
+namespace al {
+
+namespace detail {
+
+inline auto page_size() noexcept -> size_t {
+    static const auto size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+/// Rounds `bytes` up to whole pages.
+inline auto round_to_pages(const size_t bytes) noexcept -> size_t {
+    const auto page = page_size();
+    return (bytes + page - 1) / page * page;
+}
+
+[[noreturn]] inline void throw_errno(const char* const what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace detail
+
+}  // namespace al
+
+#endif  // AL_DETAIL_PAGES_HPP
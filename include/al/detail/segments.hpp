@@ -0,0 +1,59 @@
+#ifndef AL_DETAIL_SEGMENTS_HPP
+#define AL_DETAIL_SEGMENTS_HPP
+
+#include <climits>
+
+#include "../array_list.hpp"
+
+#if AL_MSVC
+#include <intrin.h>
+#endif
+
+namespace al {
+
+namespace detail {
+
+/// `floor_log2` in a single instruction where the compiler offers one, for
+/// a non-zero `value`.
+inline auto highest_bit(const size_t value) noexcept -> size_t {
+#if AL_GCC || AL_CLANG
+    return sizeof(unsigned long long) * CHAR_BIT - 1 -
+           static_cast<size_t>(__builtin_clzll(value));
+#elif AL_MSVC && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return index;
+#else
+    return floor_log2(value);
+#endif
+}
+
+/// Maps indices onto segments that double in size: segment `k` holds
+/// `First << k` elements, so elements never move as segments are added and
+/// `Count` segments address any index.
+template <size_t First>
+struct Segments {
+    static_assert(First != 0 and (First & (First - 1)) == 0,
+                  "Requires the first segment size to be a power of two");
+
+    static constexpr size_t Shift = floor_log2(First);
+    static constexpr size_t Count = sizeof(size_t) * CHAR_BIT - Shift;
+
+    static auto segment_of(const size_t index) noexcept -> size_t {
+        return highest_bit(index + First) - Shift;
+    }
+
+    static constexpr auto start_of(const size_t segment) noexcept -> size_t {
+        return (First << segment) - First;
+    }
+
+    static constexpr auto size_of(const size_t segment) noexcept -> size_t {
+        return First << segment;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace al
+
+#endif  // AL_DETAIL_SEGMENTS_HPP
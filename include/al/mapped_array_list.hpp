@@ -0,0 +1,478 @@
+#ifndef MAPPED_ARRAY_LIST_HPP
+#define MAPPED_ARRAY_LIST_HPP
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "array_list.hpp"
+#include "detail/pages.hpp"
+
+namespace al {
+
+/// Hints for how a MappedArrayList is about to be read, passed on to the
+/// kernel's readahead.
+enum class MappedAdvice { Normal, Sequential, Random, WillNeed };
+
+namespace detail {
+
+/// The start of every mapped file. Elements follow at `MappedHeaderBytes`,
+/// so they are aligned to a cache line.
+struct MappedHeader {
+    static constexpr char Magic[8] = {'A', 'L', 'M', 'A', 'P', 'P', 'E', 'D'};
+    static constexpr std::uint32_t Version = 1;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t size;
+};
+
+constexpr size_t MappedHeaderBytes = 64;
+static_assert(sizeof(MappedHeader) <= MappedHeaderBytes,
+              "Requires the header to fit before the first element");
+
+}  // namespace detail
+
+/// An ArrayList whose storage is a file mapped into memory. Opening an
+/// existing file hands its elements back as they are, with no parsing or
+/// copying; pages are only read in as they are touched. The list grows
+/// the file with `ftruncate` and the mapping with `mremap` where there is
+/// one.
+///
+/// Elements are stored as raw bytes, so they must be trivially copyable and
+/// the file only makes sense to a program with the same layout for `Type`.
+/// The element count on disk is updated by `flush` and when the list is
+/// closed; the elements themselves reach the file like any shared mapping.
+template <typename Type, typename GrowthPolicy = GeometricGrowth<>>
+class MappedArrayList {
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "Requires a trivially copyable type to store as bytes");
+    static_assert(alignof(Type) <= detail::MappedHeaderBytes,
+                  "Requires a type aligned to at most a cache line");
+
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using iterator = Type*;
+    using const_iterator = const Type*;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    // NOLINTEND
+
+    /// Opens the list stored at `path`, creating an empty one if there is
+    /// no such file. Throws `std::system_error` if the file cannot be
+    /// opened or mapped, and `std::runtime_error` if it holds something else.
+    explicit MappedArrayList(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            detail::throw_errno("Cannot open mapped file");
+        }
+        try {
+            attach();
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    MappedArrayList(MappedArrayList&& other) noexcept { steal(other); }
+
+    auto operator=(MappedArrayList&& other) noexcept -> MappedArrayList& {
+        if (this != std::addressof(other)) {
+            close();
+            steal(other);
+        }
+        return *this;
+    }
+
+    MappedArrayList(const MappedArrayList&) = delete;
+    auto operator=(const MappedArrayList&) -> MappedArrayList& = delete;
+
+    ~MappedArrayList() { close(); }
+
+    /// Records the size, unmaps the file and closes it. The list is empty
+    /// and unusable afterwards.
+    void close() noexcept {
+        if (map_ != nullptr) {
+            header().size = size_;
+        }
+        release();
+    }
+
+    AL_NODISCARD auto is_open() const noexcept -> bool {
+        return map_ != nullptr;
+    }
+
+    AL_NODISCARD auto size() const noexcept -> size_type { return size_; }
+
+    AL_NODISCARD auto empty() const noexcept -> bool { return size_ == 0; }
+
+    AL_NODISCARD auto capacity() const noexcept -> size_type {
+        return capacity_;
+    }
+
+    static constexpr auto max_size() noexcept -> size_type {
+        return (static_cast<size_type>(-1) / 2 - detail::MappedHeaderBytes) /
+               sizeof(value_type);
+    }
+
+    AL_NODISCARD auto data() noexcept -> pointer { return data_; }
+
+    AL_NODISCARD auto data() const noexcept -> const_pointer { return data_; }
+
+    AL_NODISCARD auto begin() noexcept -> iterator { return data_; }
+
+    AL_NODISCARD auto end() noexcept -> iterator { return data_ + size_; }
+
+    AL_NODISCARD auto begin() const noexcept -> const_iterator {
+        return data_;
+    }
+
+    AL_NODISCARD auto end() const noexcept -> const_iterator {
+        return data_ + size_;
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) noexcept -> reference {
+        return data_[index];
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) const noexcept
+        -> const_reference {
+        return data_[index];
+    }
+
+    AL_NODISCARD auto at(const size_type index) -> reference {
+        ensure_in_range(index);
+        return data_[index];
+    }
+
+    AL_NODISCARD auto at(const size_type index) const -> const_reference {
+        ensure_in_range(index);
+        return data_[index];
+    }
+
+    AL_NODISCARD auto front() -> reference {
+        ensure_not_empty();
+        return data_[0];
+    }
+
+    AL_NODISCARD auto front() const -> const_reference {
+        ensure_not_empty();
+        return data_[0];
+    }
+
+    AL_NODISCARD auto back() -> reference {
+        ensure_not_empty();
+        return data_[size_ - 1];
+    }
+
+    AL_NODISCARD auto back() const -> const_reference {
+        ensure_not_empty();
+        return data_[size_ - 1];
+    }
+
+    void push_back(const Type& value) { emplace_back(value); }
+
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> reference {
+        // Built first, since growing may move the mapping `args` point into.
+        const Type value(std::forward<Args>(args)...);
+        if (size_ == capacity_) {
+            grow(size_ + 1);
+        }
+        std::memcpy(static_cast<void*>(data_ + size_), &value, sizeof(Type));
+        return data_[size_++];
+    }
+
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    void append(Iter first, Iter last,
+                typename std::enable_if<detail::IsIteratorV<Iter>,
+                                        std::true_type>::type /* */
+                = {}) {
+        append_range(first, last, detail::IterConcatenateType<Iter>{});
+    }
+
+    void pop_back() {
+        ensure_not_empty();
+        --size_;
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    /// Resizes the list, value-initializing new elements.
+    void resize(const size_type count) {
+        if (count > capacity_) {
+            grow(count);
+        }
+        for (auto index = size_; index < count; ++index) {
+            ::new (static_cast<void*>(data_ + index)) Type();
+        }
+        size_ = count;
+    }
+
+    void reserve(const size_type new_capacity) {
+        if (new_capacity > capacity_) {
+            remap(new_capacity);
+        }
+    }
+
+    /// Shrinks the file to the pages the elements need.
+    void shrink_to_fit() {
+        if (size_ < capacity_) {
+            remap(size_);
+        }
+    }
+
+    /// Records the size and waits until every change is written to the
+    /// file.
+    void flush() {
+        header().size = size_;
+        if (::msync(map_, mapped_bytes_, MS_SYNC) != 0) {
+            detail::throw_errno("Cannot flush mapped file");
+        }
+    }
+
+    /// Tells the kernel how the elements are about to be read.
+    void advise(const MappedAdvice advice) {
+        const int error = ::posix_madvise(map_, mapped_bytes_,
+                                          native_advice(advice));
+        if (error != 0) {
+            throw std::system_error(error, std::generic_category(),
+                                    "Cannot advise mapped file");
+        }
+    }
+
+   private:
+    auto header() noexcept -> detail::MappedHeader& {
+        return *reinterpret_cast<detail::MappedHeader*>(map_);
+    }
+
+    /// Maps the open file, setting up the header of a new one or checking
+    /// that of an existing one.
+    void attach() {
+        struct stat status {};
+        if (::fstat(fd_, &status) != 0) {
+            detail::throw_errno("Cannot stat mapped file");
+        }
+        const auto bytes = static_cast<size_t>(status.st_size);
+        if (bytes == 0) {
+            resize_file(detail::page_size());
+            map(detail::page_size());
+            auto& fresh = header();
+            std::memcpy(fresh.magic, detail::MappedHeader::Magic,
+                        sizeof(fresh.magic));
+            fresh.version = detail::MappedHeader::Version;
+            fresh.element_size = sizeof(Type);
+            fresh.size = 0;
+            return;
+        }
+        if (bytes < detail::MappedHeaderBytes) {
+            throw std::runtime_error("Not a MappedArrayList file");
+        }
+
+        map(bytes);
+        const auto& existing = header();
+        if (std::memcmp(existing.magic, detail::MappedHeader::Magic,
+                        sizeof(existing.magic)) != 0 or
+            existing.version != detail::MappedHeader::Version) {
+            throw std::runtime_error("Not a MappedArrayList file");
+        }
+        if (existing.element_size != sizeof(Type)) {
+            throw std::runtime_error(
+                "MappedArrayList file holds elements of another size");
+        }
+        if (existing.size > capacity_) {
+            throw std::runtime_error("MappedArrayList file is truncated");
+        }
+        size_ = static_cast<size_type>(existing.size);
+    }
+
+    void map(const size_t bytes) {
+        void* const address =
+            ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (address == MAP_FAILED) {
+            detail::throw_errno("Cannot map file");
+        }
+        adopt(address, bytes);
+    }
+
+    void adopt(void* const address, const size_t bytes) noexcept {
+        map_ = static_cast<unsigned char*>(address);
+        mapped_bytes_ = bytes;
+        data_ = reinterpret_cast<pointer>(map_ + detail::MappedHeaderBytes);
+        capacity_ = (bytes - detail::MappedHeaderBytes) / sizeof(Type);
+    }
+
+    void resize_file(const size_t bytes) {
+        if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+            detail::throw_errno("Cannot resize mapped file");
+        }
+    }
+
+    void grow(const size_type required) {
+        if (required > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        remap(static_cast<size_type>(
+            growth_policy_(capacity_, required, max_size(), sizeof(Type))));
+    }
+
+    /// Resizes the file and the mapping to hold `new_capacity` elements,
+    /// rounded up to whole pages.
+    void remap(const size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        const auto bytes = detail::round_to_pages(detail::MappedHeaderBytes +
+                                                  new_capacity * sizeof(Type));
+        if (bytes == mapped_bytes_) {
+            return;
+        }
+        const auto old_bytes = mapped_bytes_;
+        // Growing extends the file before mapping it; shrinking unmaps first,
+        // since touching a mapping past the end of its file faults.
+        if (bytes > old_bytes) {
+            resize_file(bytes);
+        }
+        try {
+            remap_bytes(bytes);
+        } catch (...) {
+            if (bytes > old_bytes) {
+                (void)::ftruncate(fd_, static_cast<off_t>(old_bytes));
+            }
+            throw;
+        }
+        if (bytes < old_bytes) {
+            resize_file(bytes);
+        }
+    }
+
+    void remap_bytes(const size_t bytes) {
+#if defined(__linux__)
+        // The kernel moves the pages instead of copying them.
+        void* const address =
+            ::mremap(map_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+        if (address == MAP_FAILED) {
+            detail::throw_errno("Cannot remap file");
+        }
+#else
+        void* const address =
+            ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (address == MAP_FAILED) {
+            detail::throw_errno("Cannot remap file");
+        }
+        ::munmap(map_, mapped_bytes_);
+#endif
+        adopt(address, bytes);
+    }
+
+    template <typename Iter>
+    void append_range(Iter first, Iter last, std::forward_iterator_tag) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if (count > capacity_ - size_) {
+            if (aliases(first)) {
+                // Growing may move the elements being appended.
+                const ArrayList<Type> staged(first, last);
+                append_range(staged.begin(), staged.end(),
+                             std::forward_iterator_tag{});
+                return;
+            }
+            grow(size_ + count);
+        }
+        std::copy(first, last, data_ + size_);
+        size_ += count;
+    }
+
+    template <typename Iter>
+    void append_range(Iter first, Iter last, std::input_iterator_tag) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    template <typename Iter>
+    auto aliases(const Iter& first) const noexcept -> bool {
+        if constexpr (std::is_convertible<Iter, const Type*>::value) {
+            const auto* const pointer = static_cast<const Type*>(first);
+            return pointer >= data_ and pointer < data_ + size_;
+        } else {
+            return false;
+        }
+    }
+
+    static auto native_advice(const MappedAdvice advice) noexcept -> int {
+        switch (advice) {
+            case MappedAdvice::Sequential:
+                return POSIX_MADV_SEQUENTIAL;
+            case MappedAdvice::Random:
+                return POSIX_MADV_RANDOM;
+            case MappedAdvice::WillNeed:
+                return POSIX_MADV_WILLNEED;
+            case MappedAdvice::Normal:
+            default:
+                return POSIX_MADV_NORMAL;
+        }
+    }
+
+    void steal(MappedArrayList& other) noexcept {
+        fd_ = std::exchange(other.fd_, -1);
+        map_ = std::exchange(other.map_, nullptr);
+        mapped_bytes_ = std::exchange(other.mapped_bytes_, 0);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        growth_policy_ = std::move(other.growth_policy_);
+    }
+
+    void release() noexcept {
+        if (map_ != nullptr) {
+            ::munmap(map_, mapped_bytes_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = -1;
+        map_ = nullptr;
+        mapped_bytes_ = 0;
+        data_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+    }
+
+    void ensure_in_range(const size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    void ensure_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("ArrayList is empty");
+        }
+    }
+
+    int fd_ = -1;
+    unsigned char* map_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    pointer data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+    GrowthPolicy growth_policy_;
+};
+
+}  // namespace al
+
+#endif  // MAPPED_ARRAY_LIST_HPP
@@ -0,0 +1,610 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "array_list.hpp"
+
+namespace al {
+
+namespace parallel {
+
+class ThreadPool;
+
+namespace detail {
+
+struct Job {
+    void (*run)(void* context, size_t chunk);
+    void* context;
+    std::atomic<size_t> remaining;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+};
+
+/// The chunks [first, last) of a job, split in half whenever a thread picks
+/// it up so idle threads can steal the other half.
+struct Task {
+    Job* job;
+    size_t first;
+    size_t last;
+};
+
+struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+struct CurrentWorker {
+    const ThreadPool* pool;
+    size_t index;
+};
+
+inline auto current_worker() noexcept -> CurrentWorker& {
+    thread_local CurrentWorker worker{nullptr, 0};
+    return worker;
+}
+
+}  // namespace detail
+
+/// A work-stealing thread pool. Every worker owns a queue, taking its own
+/// tasks newest first and stealing from the others oldest first. A thread
+/// that runs an algorithm works on it too instead of blocking, so nested
+/// algorithms cannot deadlock.
+class ThreadPool {
+   public:
+    /// Uses `threads` threads in total: the caller and `threads - 1` workers.
+    explicit ThreadPool(
+        const size_t threads = std::thread::hardware_concurrency()) {
+        const auto workers = threads > 1 ? threads - 1 : 0;
+        // Threads from outside the pool share the last queue.
+        for (size_t index = 0; index <= workers; ++index) {
+            queues_.push_back(
+                std::unique_ptr<detail::Queue>(new detail::Queue));
+        }
+        for (size_t index = 0; index < workers; ++index) {
+            threads_.emplace_back([this, index] { work(index); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    ~ThreadPool() {
+        {
+            const std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    /// The number of threads working on an algorithm, including the caller.
+    AL_NODISCARD auto size() const noexcept -> size_t { return queues_.size(); }
+
+    /// Calls `function(chunk)` for every chunk in [0, count) and returns once
+    /// all calls have finished. The first exception thrown is rethrown here;
+    /// chunks that have not started by then are skipped.
+    template <class Function>
+    void run(const size_t count, Function&& function) {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1 or size() == 1) {
+            for (size_t chunk = 0; chunk < count; ++chunk) {
+                function(chunk);
+            }
+            return;
+        }
+
+        using Callable = typename std::remove_reference<Function>::type;
+        detail::Job job;
+        job.run = [](void* const context, const size_t chunk) {
+            (*static_cast<Callable*>(context))(chunk);
+        };
+        job.context = static_cast<void*>(std::addressof(function));
+        job.remaining.store(count, std::memory_order_relaxed);
+
+        const auto index = own_queue();
+        execute(index, detail::Task{&job, 0, count});
+        while (job.remaining.load(std::memory_order_acquire) != 0) {
+            if (not run_one(index)) {
+                std::this_thread::yield();
+            }
+        }
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+
+   private:
+    auto own_queue() const noexcept -> size_t {
+        const auto& worker = detail::current_worker();
+        return worker.pool == this ? worker.index : queues_.size() - 1;
+    }
+
+    void work(const size_t index) {
+        detail::current_worker() = detail::CurrentWorker{this, index};
+        while (true) {
+            if (run_one(index)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            wake_.wait(lock, [this] {
+                return stopping_ or
+                       queued_.load(std::memory_order_relaxed) != 0;
+            });
+            if (stopping_) {
+                return;
+            }
+        }
+    }
+
+    auto run_one(const size_t index) -> bool {
+        detail::Task task{};
+        if (pop(index, task)) {
+            execute(index, task);
+            return true;
+        }
+        for (size_t offset = 1; offset < queues_.size(); ++offset) {
+            if (steal((index + offset) % queues_.size(), task)) {
+                execute(index, task);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(const size_t index, detail::Task task) {
+        while (task.last - task.first > 1) {
+            const auto middle = task.first + (task.last - task.first) / 2;
+            push(index, detail::Task{task.job, middle, task.last});
+            task.last = middle;
+        }
+
+        auto& job = *task.job;
+        if (not job.failed.load(std::memory_order_relaxed)) {
+            try {
+                job.run(job.context, task.first);
+            } catch (...) {
+                if (not job.failed.exchange(true)) {
+                    job.error = std::current_exception();
+                }
+            }
+        }
+        // The job lives on the stack of the thread waiting for it, and may be
+        // gone as soon as this reaches zero.
+        job.remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void push(const size_t index, const detail::Task task) {
+        auto& queue = *queues_[index];
+        {
+            const std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(task);
+            queued_.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+            const std::lock_guard<std::mutex> lock(sleep_mutex_);
+        }
+        wake_.notify_one();
+    }
+
+    auto pop(const size_t index, detail::Task& task) -> bool {
+        auto& queue = *queues_[index];
+        const std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    auto steal(const size_t index, detail::Task& task) -> bool {
+        auto& queue = *queues_[index];
+        const std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = queue.tasks.front();
+        queue.tasks.pop_front();
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::vector<std::unique_ptr<detail::Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> queued_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
+
+/// The pool used when an algorithm is not given one, with a thread per core.
+inline auto default_pool() -> ThreadPool& {
+    static ThreadPool pool;
+    return pool;
+}
+
+namespace detail {
+
+constexpr size_t CacheLine = 64;
+constexpr size_t MinChunkBytes = 16U * 1024U;
+constexpr size_t ChunksPerThread = 4;
+
+/// Splits `size` elements starting at `data` into chunks whose inner
+/// boundaries fall on cache line boundaries, so no two chunks share a line.
+class Chunks {
+   public:
+    template <class Type>
+    Chunks(const Type* const data, const size_t size, const size_t chunks)
+        : size_(size) {
+        size_t line = 1;
+        const auto address = reinterpret_cast<std::uintptr_t>(data);
+        if (CacheLine % sizeof(Type) == 0 and address % sizeof(Type) == 0) {
+            line = CacheLine / sizeof(Type);
+            head_ =
+                (CacheLine - address % CacheLine) % CacheLine / sizeof(Type);
+        }
+        const auto minimum = std::max<size_t>(1, MinChunkBytes / sizeof(Type));
+        const auto wanted = (size + chunks - 1) / std::max<size_t>(chunks, 1);
+        chunk_ = (std::max(minimum, wanted) + line - 1) / line * line;
+    }
+
+    AL_NODISCARD auto count() const noexcept -> size_t {
+        if (size_ == 0) {
+            return 0;
+        }
+        if (size_ <= head_ + chunk_) {
+            return 1;
+        }
+        return 1 + (size_ - head_ - 1) / chunk_;
+    }
+
+    AL_NODISCARD auto begin(const size_t chunk) const noexcept -> size_t {
+        return chunk == 0 ? 0 : std::min(size_, head_ + chunk * chunk_);
+    }
+
+    AL_NODISCARD auto end(const size_t chunk) const noexcept -> size_t {
+        return std::min(size_, head_ + (chunk + 1) * chunk_);
+    }
+
+   private:
+    size_t size_;
+    size_t head_ = 0;
+    size_t chunk_ = 1;
+};
+
+template <class Type>
+auto chunks_for(const Type* const data, const size_t size,
+                const ThreadPool& pool) -> Chunks {
+    return Chunks(data, size, pool.size() * ChunksPerThread);
+}
+
+template <class Type>
+void destroy(Type* first, Type* const last) noexcept {
+    for (; first != last; ++first) {
+        first->~Type();
+    }
+}
+
+/// Constructs `out[offsets[chunk], offsets[chunk + 1])` for every chunk in
+/// parallel, where `fill(chunk, emit)` calls `emit(args...)` once per element
+/// in order. If any chunk throws, everything constructed is destroyed again.
+template <class Type, class Fill>
+void fill_chunks(ThreadPool& pool, Type* const out, const size_t* const offsets,
+                 const size_t count, Fill& fill) {
+    ArrayList<unsigned char> done;
+    done.resize(count);
+    try {
+        pool.run(count, [&](const size_t chunk) {
+            Type* const first = out + offsets[chunk];
+            Type* cursor = first;
+            try {
+                fill(chunk, [&cursor](auto&&... args) {
+                    ::new (static_cast<void*>(cursor))
+                        Type(std::forward<decltype(args)>(args)...);
+                    ++cursor;
+                });
+            } catch (...) {
+                destroy(first, cursor);
+                throw;
+            }
+            done[chunk] = 1;
+        });
+    } catch (...) {
+        for (size_t chunk = 0; chunk < count; ++chunk) {
+            if (done[chunk] != 0) {
+                destroy(out + offsets[chunk], out + offsets[chunk + 1]);
+            }
+        }
+        throw;
+    }
+}
+
+template <class Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Fill>
+void append_chunks(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& out,
+                   const ArrayList<size_t>& offsets, ThreadPool& pool,
+                   Fill fill) {
+    const auto count = offsets.size() - 1;
+    const auto total = offsets.back();
+    out.append_with(total, [&](Type* const tail, size_t /* room */) {
+        fill_chunks(pool, tail, offsets.data(), count, fill);
+        return total;
+    });
+}
+
+/// Copies the flagged elements of `first[index, end)` to `out`, which has
+/// room for exactly the matches up to `last`. Storing every element and only
+/// advancing past matches avoids a mispredicted branch per element; the last
+/// slot is filled with a branch so nothing is written past `last`.
+template <class Type>
+void compact(const Type* const first, const unsigned char* const flags,
+             size_t index, const size_t end, Type* out, Type* const last) {
+    for (; index != end and last - out > 1; ++index) {
+        std::memcpy(static_cast<void*>(out), first + index, sizeof(Type));
+        out += flags[index];
+    }
+    for (; index != end; ++index) {
+        if (flags[index] != 0) {
+            std::memcpy(static_cast<void*>(out), first + index, sizeof(Type));
+            ++out;
+        }
+    }
+}
+
+template <class Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+void copy_flagged(const Type* const first, const unsigned char* const flags,
+                  const Chunks& chunks, const ArrayList<size_t>& offsets,
+                  ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& output,
+                  ThreadPool& pool, std::true_type /* trivially copyable */) {
+    const auto total = offsets.back();
+    output.append_with(total, [&](Type* const tail, size_t /* room */) {
+        pool.run(offsets.size() - 1, [&](const size_t chunk) {
+            compact(first, flags, chunks.begin(chunk), chunks.end(chunk),
+                    tail + offsets[chunk], tail + offsets[chunk + 1]);
+        });
+        return total;
+    });
+}
+
+template <class Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+void copy_flagged(const Type* const first, const unsigned char* const flags,
+                  const Chunks& chunks, const ArrayList<size_t>& offsets,
+                  ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& output,
+                  ThreadPool& pool, std::false_type /* trivially copyable */) {
+    append_chunks(output, offsets, pool, [&](const size_t chunk, auto emit) {
+        const auto end = chunks.end(chunk);
+        for (auto index = chunks.begin(chunk); index != end; ++index) {
+            if (flags[index] != 0) {
+                emit(first[index]);
+            }
+        }
+    });
+}
+
+}  // namespace detail
+
+/// Calls `function(element)` for every element of [first, last).
+template <class Type, class Function>
+void for_each(Type* const first, Type* const last, Function function,
+              ThreadPool& pool = default_pool()) {
+    const auto chunks =
+        detail::chunks_for(first, static_cast<size_t>(last - first), pool);
+    pool.run(chunks.count(), [&](const size_t chunk) {
+        for (auto* it = first + chunks.begin(chunk);
+             it != first + chunks.end(chunk); ++it) {
+            function(*it);
+        }
+    });
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Function>
+void for_each(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+              Function function, ThreadPool& pool = default_pool()) {
+    parallel::for_each(list.begin(), list.end(), std::move(function), pool);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Function>
+void for_each(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+              Function function, ThreadPool& pool = default_pool()) {
+    parallel::for_each(list.begin(), list.end(), std::move(function), pool);
+}
+
+/// Appends `function(element)` for every element of [first, last) to
+/// `output`. The results are constructed in place, so a reserved `output` is
+/// never reallocated.
+template <class Input, class Output, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Function>
+void transform(const Input* const first, const Input* const last,
+               ArrayList<Output, Allocator, GrowthPolicy, StatsPolicy>& output,
+               Function function, ThreadPool& pool = default_pool()) {
+    // Chunks follow the output, which is written to.
+    const auto size = static_cast<size_t>(last - first);
+    output.reserve(output.size() + size);
+    const auto chunks =
+        detail::chunks_for(output.data() + output.size(), size, pool);
+
+    ArrayList<size_t> offsets;
+    offsets.reserve(chunks.count() + 1);
+    for (size_t chunk = 0; chunk < chunks.count(); ++chunk) {
+        offsets.push_back(chunks.begin(chunk));
+    }
+    offsets.push_back(size);
+
+    detail::append_chunks(output, offsets, pool,
+                          [&](const size_t chunk, auto emit) {
+                              for (auto index = chunks.begin(chunk);
+                                   index != chunks.end(chunk); ++index) {
+                                  emit(function(first[index]));
+                              }
+                          });
+}
+
+template <typename Input, typename InputAllocator, typename InputGrowth,
+          typename InputStats, class Output, typename Allocator,
+          typename GrowthPolicy, typename StatsPolicy, class Function>
+void transform(
+    const ArrayList<Input, InputAllocator, InputGrowth, InputStats>& input,
+    ArrayList<Output, Allocator, GrowthPolicy, StatsPolicy>& output,
+    Function function, ThreadPool& pool = default_pool()) {
+    parallel::transform(input.data(), input.data() + input.size(), output,
+                        std::move(function), pool);
+}
+
+/// Combines `init` and every element of [first, last) with `operation`,
+/// which must be associative: elements are grouped in chunks, but the order
+/// of the elements is kept.
+template <class Type, class Result, class Operation>
+auto reduce(const Type* const first, const Type* const last, Result init,
+            Operation operation, ThreadPool& pool = default_pool()) -> Result {
+    const auto chunks =
+        detail::chunks_for(first, static_cast<size_t>(last - first), pool);
+    const auto count = chunks.count();
+
+    ArrayList<Result> partials;
+    ArrayList<size_t> offsets;
+    offsets.reserve(count + 1);
+    for (size_t chunk = 0; chunk <= count; ++chunk) {
+        offsets.push_back(chunk);
+    }
+    detail::append_chunks(partials, offsets, pool,
+                          [&](const size_t chunk, auto emit) {
+                              const auto* it = first + chunks.begin(chunk);
+                              const auto* const end = first + chunks.end(chunk);
+                              Result partial(*it);
+                              while (++it != end) {
+                                  partial = operation(std::move(partial), *it);
+                              }
+                              emit(std::move(partial));
+                          });
+
+    for (auto& partial : partials) {
+        init = operation(std::move(init), std::move(partial));
+    }
+    return init;
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Result, class Operation>
+auto reduce(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+            Result init, Operation operation, ThreadPool& pool = default_pool())
+    -> Result {
+    return parallel::reduce(list.data(), list.data() + list.size(),
+                            std::move(init), std::move(operation), pool);
+}
+
+/// Appends a copy of every element of [first, last) that satisfies
+/// `predicate` to `output`, in order, and returns how many were copied. The
+/// predicate is called once per element.
+template <class Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Predicate>
+auto copy_if(const Type* const first, const Type* const last,
+             ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& output,
+             Predicate predicate, ThreadPool& pool = default_pool()) -> size_t {
+    const auto size = static_cast<size_t>(last - first);
+    const auto chunks = detail::chunks_for(first, size, pool);
+    const auto count = chunks.count();
+
+    // The first pass flags the matches and counts them per chunk. Storing
+    // the predicate's result and counting afterwards keeps the loops free of
+    // branches on it.
+    ArrayList<unsigned char> matches;
+    matches.resize_for_overwrite(size);
+    unsigned char* const flags = matches.data();
+    ArrayList<size_t> offsets;
+    offsets.resize(count + 1);
+    pool.run(count, [&](const size_t chunk) {
+        const auto begin = chunks.begin(chunk);
+        const auto end = chunks.end(chunk);
+        for (auto index = begin; index != end; ++index) {
+            flags[index] = static_cast<unsigned char>(
+                static_cast<bool>(predicate(first[index])));
+        }
+        offsets[chunk + 1] = static_cast<size_t>(std::count(
+            flags + begin, flags + end, static_cast<unsigned char>(1)));
+    });
+    for (size_t chunk = 0; chunk < count; ++chunk) {
+        offsets[chunk + 1] += offsets[chunk];
+    }
+
+    detail::copy_flagged(first, flags, chunks, offsets, output, pool,
+                         std::is_trivially_copyable<Type>{});
+    return offsets.back();
+}
+
+template <typename Type, typename InputAllocator, typename InputGrowth,
+          typename InputStats, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Predicate>
+auto copy_if(
+    const ArrayList<Type, InputAllocator, InputGrowth, InputStats>& input,
+    ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& output,
+    Predicate predicate, ThreadPool& pool = default_pool()) -> size_t {
+    return parallel::copy_if(input.data(), input.data() + input.size(), output,
+                             std::move(predicate), pool);
+}
+
+/// Sorts [first, last) by sorting one chunk per thread and then merging
+/// neighbouring runs in parallel rounds. Not stable.
+template <class Type, class Compare = std::less<Type>>
+void sort(Type* const first, Type* const last, Compare compare = Compare(),
+          ThreadPool& pool = default_pool()) {
+    const auto size = static_cast<size_t>(last - first);
+    const detail::Chunks chunks(first, size, pool.size());
+    const auto count = chunks.count();
+    pool.run(count, [&](const size_t chunk) {
+        std::sort(first + chunks.begin(chunk), first + chunks.end(chunk),
+                  compare);
+    });
+
+    // Round `width` merges runs of `width` chunks pairwise.
+    for (size_t width = 1; width < count; width *= 2) {
+        const auto merges = (count + 2 * width - 1) / (2 * width);
+        pool.run(merges, [&](const size_t merge) {
+            const auto begin = merge * 2 * width;
+            const auto middle = begin + width;
+            if (middle >= count) {
+                return;
+            }
+            const auto end = std::min(count, middle + width);
+            std::inplace_merge(first + chunks.begin(begin),
+                               first + chunks.begin(middle),
+                               first + chunks.end(end - 1), compare);
+        });
+    }
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class Compare = std::less<Type>>
+void sort(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+          Compare compare = Compare(), ThreadPool& pool = default_pool()) {
+    parallel::sort(list.begin(), list.end(), std::move(compare), pool);
+}
+
+}  // namespace parallel
+
+}  // namespace al
+
+#endif  // PARALLEL_HPP
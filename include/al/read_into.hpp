@@ -0,0 +1,277 @@
+#ifndef READ_INTO_HPP
+#define READ_INTO_HPP
+
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "array_list.hpp"
+#include "detail/io.hpp"
+
+namespace al {
+
+/// How `read_into` takes input from its source.
+struct ReadOptions {
+    /// Bytes asked of the source at a time.
+    size_t chunk_bytes = size_t{1} << 20U;
+    /// Reserves for the rest of a regular file once, up front, when reading
+    /// elements as bytes.
+    bool use_size_hint = true;
+    /// Reads the next chunk on a background thread while the current one is
+    /// appended or parsed. Costs a copy of every chunk; pays off when parsing
+    /// is slow or the source stalls, as pipes and sockets do.
+    bool background = false;
+};
+
+namespace detail {
+
+/// Reads ahead of its caller on a thread of its own, into two buffers taken
+/// in turn. `read` keeps the contract of `read_up_to`.
+template <class Source>
+class BackgroundReader {
+   public:
+    BackgroundReader(Source& source, const size_t chunk_bytes)
+        : source_(&source) {
+        for (auto& slot : slots_) {
+            slot.data.resize_for_overwrite(chunk_bytes != 0 ? chunk_bytes : 1);
+        }
+        thread_ = std::thread([this] { produce(); });
+    }
+
+    BackgroundReader(const BackgroundReader&) = delete;
+    auto operator=(const BackgroundReader&) -> BackgroundReader& = delete;
+
+    /// Waits for a read already handed to the source to return.
+    ~BackgroundReader() {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        changed_.notify_all();
+        thread_.join();
+    }
+
+    auto read(void* const data, const size_t bytes) -> size_t {
+        auto* const out = static_cast<char*>(data);
+        size_t total = 0;
+        while (total < bytes) {
+            if (current_ == nullptr and not take_slot()) {
+                break;
+            }
+            const auto left = current_->size - offset_;
+            const auto copied = bytes - total < left ? bytes - total : left;
+            std::memcpy(out + total, current_->data.data() + offset_, copied);
+            total += copied;
+            offset_ += copied;
+            if (offset_ == current_->size) {
+                release_slot();
+            }
+        }
+        return total;
+    }
+
+   private:
+    struct Slot {
+        ArrayList<char> data;
+        size_t size = 0;
+    };
+
+    void produce() {
+        for (size_t index = 0;; index ^= 1U) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                changed_.wait(lock,
+                              [this] { return stopping_ or filled_ < 2; });
+                if (stopping_) {
+                    return;
+                }
+            }
+            auto& slot = slots_[index];
+            bool end = false;
+            try {
+                slot.size =
+                    read_up_to(*source_, slot.data.data(), slot.data.size());
+                end = slot.size < slot.data.size();
+            } catch (...) {
+                {
+                    const std::lock_guard<std::mutex> lock(mutex_);
+                    error_ = std::current_exception();
+                    ended_ = true;
+                }
+                changed_.notify_all();
+                return;
+            }
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                ++filled_;
+                ended_ = end;
+            }
+            changed_.notify_all();
+            if (end) {
+                return;
+            }
+        }
+    }
+
+    auto take_slot() -> bool {
+        std::unique_lock<std::mutex> lock(mutex_);
+        changed_.wait(lock, [this] { return filled_ != 0 or ended_; });
+        if (filled_ == 0) {
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+            return false;
+        }
+        current_ = &slots_[taken_];
+        offset_ = 0;
+        return true;
+    }
+
+    void release_slot() {
+        current_ = nullptr;
+        taken_ ^= 1U;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            --filled_;
+        }
+        changed_.notify_all();
+    }
+
+    Source* source_;
+    Slot slots_[2];
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    size_t filled_ = 0;
+    bool ended_ = false;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    // Touched by the reading side only.
+    Slot* current_ = nullptr;
+    size_t offset_ = 0;
+    size_t taken_ = 0;
+};
+
+/// Calls `body(next)`, where `next(data, bytes)` reads like `read_up_to`,
+/// from the source itself or through a BackgroundReader.
+template <class Source, class Body>
+void with_reader(Source& source, const ReadOptions& options, Body&& body) {
+    if (options.background) {
+        BackgroundReader<Source> reader(source, options.chunk_bytes);
+        body([&reader](void* const data, const size_t bytes) {
+            return reader.read(data, bytes);
+        });
+    } else {
+        body([&source](void* const data, const size_t bytes) {
+            return read_up_to(source, data, bytes);
+        });
+    }
+}
+
+}  // namespace detail
+
+/// Appends the rest of `source` to `list` as raw elements, read in large
+/// chunks straight into its uninitialized tail. A regular file reserves
+/// once for its remaining size, so the list does not grow while reading.
+/// Returns the number of elements appended. Throws `std::runtime_error` if
+/// the input ends inside an element, keeping the whole ones before it.
+template <class Type, class Allocator, class GrowthPolicy, class StatsPolicy,
+          class Source>
+auto read_into(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+               Source&& source, const ReadOptions& options = ReadOptions())
+    -> size_t {
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "Requires a trivially copyable type to read as bytes; "
+                  "pass a parser for other types");
+    const auto before = list.size();
+    const size_t chunk =
+        options.chunk_bytes > sizeof(Type) ? options.chunk_bytes / sizeof(Type)
+                                           : 1;
+
+    size_t least = chunk;
+    if (options.use_size_hint) {
+        if (const auto bytes = detail::remaining_size(source)) {
+            // One element more than the hint sees the end without growing.
+            least = *bytes / sizeof(Type) + 1;
+            list.reserve(before + least);
+        }
+    }
+
+    size_t partial = 0;
+    detail::with_reader(source, options, [&](auto&& next) {
+        for (;;) {
+            const auto room = list.capacity() - list.size();
+            const auto request = room > least ? room : least;
+            size_t bytes = 0;
+            list.append_with(request, [&](Type* const tail,
+                                          const size_t count) {
+                bytes = next(tail, count * sizeof(Type));
+                return bytes / sizeof(Type);
+            });
+            if (bytes < request * sizeof(Type)) {
+                partial = bytes % sizeof(Type);
+                return;
+            }
+            least = chunk;
+        }
+    });
+    if (partial != 0) {
+        throw std::runtime_error("Input ends inside an element");
+    }
+    return list.size() - before;
+}
+
+/// Feeds the rest of `source` to `parser` a chunk at a time, so records are
+/// appended to `list` while the next chunk is read. The parser is called as
+/// `parser(list, data, size, last) -> size_t`: it appends what it can parse
+/// from the `size` bytes at `data` and returns how many bytes it used. Bytes
+/// it leaves are handed to it again, followed by more input; once `last`
+/// is set the input has ended and it must use them all. Returns the number
+/// of elements appended. Throws `std::runtime_error` if the parser leaves
+/// bytes at the end.
+template <class Type, class Allocator, class GrowthPolicy, class StatsPolicy,
+          class Source, class Parser,
+          class = typename std::enable_if<not std::is_same<
+              typename std::decay<Parser>::type, ReadOptions>::value>::type>
+auto read_into(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+               Source&& source, Parser&& parser,
+               const ReadOptions& options = ReadOptions()) -> size_t {
+    const auto before = list.size();
+    ArrayList<char> buffer;
+    buffer.resize_for_overwrite(options.chunk_bytes != 0 ? options.chunk_bytes
+                                                         : 1);
+
+    detail::with_reader(source, options, [&](auto&& next) {
+        size_t pending = 0;
+        for (bool last = false; not last;) {
+            // A record larger than half the buffer gets a larger buffer.
+            if (pending > buffer.size() / 2) {
+                buffer.resize_for_overwrite(buffer.size() * 2);
+            }
+            const auto room = buffer.size() - pending;
+            const auto read = next(buffer.data() + pending, room);
+            last = read < room;
+            const auto available = pending + read;
+            const size_t used = parser(
+                list, static_cast<const char*>(buffer.data()), available, last);
+            if (used > available) {
+                throw std::logic_error("Parser used more bytes than it had");
+            }
+            if (last and used != available) {
+                throw std::runtime_error("Input ends inside a record");
+            }
+            pending = available - used;
+            std::memmove(buffer.data(), buffer.data() + used, pending);
+        }
+    });
+    return list.size() - before;
+}
+
+}  // namespace al
+
+#endif  // READ_INTO_HPP
@@ -0,0 +1,744 @@
+#ifndef SEGMENTED_ARRAY_LIST_HPP
+#define SEGMENTED_ARRAY_LIST_HPP
+
+#include <initializer_list>
+
+#include "array_list.hpp"
+#include "detail/segments.hpp"
+
+namespace al {
+
+/// A list that grows by adding segments twice the size of the last instead
+/// of relocating, so elements never move and references, pointers and
+/// iterators to them stay valid until they are erased. Indexing goes
+/// through a small table of segments in constant time, and `freeze` turns
+/// it into a contiguous ArrayList with a single allocation.
+///
+/// The table lives inside the list, and iterators walk it. References and
+/// pointers follow the elements through a swap or move, but iterators stay
+/// with the list object they came from, so they do not survive either.
+template <typename Type, typename Allocator = std::allocator<Type>>
+AL_REQUIRES(std::is_object<Type>::value)
+class SegmentedArrayList {
+    static_assert(
+        std::is_same<Type, typename Allocator::value_type>::value,
+        "Requires allocator's type to match the type held by the ArrayList");
+    static_assert(std::is_object<Type>::value,
+                  "Requires type held by the ArrayList to be an object");
+
+    // NOLINTBEGIN
+    using Alty =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Type>;
+    using AltyTraits = std::allocator_traits<Alty>;
+
+    template <bool Const>
+    class Iterator;
+
+   public:
+    using value_type = Type;
+    using allocator_type = Alty;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using size_type = typename AltyTraits::size_type;
+    using difference_type = typename AltyTraits::difference_type;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    // NOLINTEND
+
+    static_assert(
+        std::is_same<typename AltyTraits::pointer, pointer>::value,
+        "Requires an allocator handing out raw pointers");
+
+    /// The number of elements in the first segment.
+    static constexpr size_type FirstSegmentSize = 32;
+
+    SegmentedArrayList() noexcept = default;
+
+    explicit SegmentedArrayList(const allocator_type& alloc) noexcept
+        : allocator_(alloc) {}
+
+    SegmentedArrayList(const size_type count, const Type& value,
+                       const allocator_type& alloc = allocator_type())
+        : allocator_(alloc) {
+        append(count, value);
+    }
+
+    SegmentedArrayList(std::initializer_list<Type> list,
+                       const allocator_type& alloc = allocator_type())
+        : allocator_(alloc) {
+        append(list.begin(), list.end());
+    }
+
+    SegmentedArrayList(const SegmentedArrayList& other)
+        : allocator_(AltyTraits::select_on_container_copy_construction(
+              other.allocator_)) {
+        append(other.begin(), other.end());
+    }
+
+    SegmentedArrayList(SegmentedArrayList&& other) noexcept
+        : allocator_(std::move(other.allocator_)) {
+        steal(other);
+    }
+
+    auto operator=(const SegmentedArrayList& other) -> SegmentedArrayList& {
+        if (this != std::addressof(other)) {
+            copy_assign(other);
+        }
+        return *this;
+    }
+
+    auto operator=(SegmentedArrayList&& other) noexcept(
+        AltyTraits::propagate_on_container_move_assignment::value or
+        AltyTraits::is_always_equal::value) -> SegmentedArrayList& {
+        if (this != std::addressof(other)) {
+            move_assign(
+                other,
+                typename AltyTraits::propagate_on_container_move_assignment{});
+        }
+        return *this;
+    }
+
+    ~SegmentedArrayList() {
+        clear();
+        release_segments(0);
+    }
+
+    AL_NODISCARD auto size() const noexcept -> size_type {
+        return limit_index_ - static_cast<size_type>(limit_ - tail_);
+    }
+
+    AL_NODISCARD auto empty() const noexcept -> bool { return size() == 0; }
+
+    AL_NODISCARD auto capacity() const noexcept -> size_type {
+        return Segments::start_of(segment_count_);
+    }
+
+    static constexpr auto max_size() noexcept -> size_type {
+        return static_cast<size_type>(-1) / sizeof(value_type) / 2;
+    }
+
+    AL_NODISCARD auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    AL_NODISCARD auto begin() noexcept -> iterator {
+        return iterator(segments_, 0);
+    }
+
+    AL_NODISCARD auto end() noexcept -> iterator {
+        return iterator(segments_, size());
+    }
+
+    AL_NODISCARD auto begin() const noexcept -> const_iterator {
+        return const_iterator(segments_, 0);
+    }
+
+    AL_NODISCARD auto end() const noexcept -> const_iterator {
+        return const_iterator(segments_, size());
+    }
+
+    AL_NODISCARD auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    AL_NODISCARD auto cend() const noexcept -> const_iterator { return end(); }
+
+    AL_NODISCARD auto operator[](const size_type index) noexcept -> reference {
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) const noexcept
+        -> const_reference {
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) -> reference {
+        ensure_in_range(index);
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) const -> const_reference {
+        ensure_in_range(index);
+        return *slot(index);
+    }
+
+    AL_NODISCARD auto front() -> reference {
+        ensure_not_empty();
+        return *slot(0);
+    }
+
+    AL_NODISCARD auto front() const -> const_reference {
+        ensure_not_empty();
+        return *slot(0);
+    }
+
+    AL_NODISCARD auto back() -> reference {
+        ensure_not_empty();
+        return *slot(size() - 1);
+    }
+
+    AL_NODISCARD auto back() const -> const_reference {
+        ensure_not_empty();
+        return *slot(size() - 1);
+    }
+
+    auto push_back(const Type& value) -> reference {
+        return emplace_back(value);
+    }
+
+    auto push_back(Type&& value) -> reference {
+        return emplace_back(std::move(value));
+    }
+
+    /// Appends an element and returns a reference to it. Growing only adds
+    /// a segment, so no other element is touched.
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> reference {
+        if (tail_ == limit_) {
+            next_segment();
+        }
+        auto* const target = tail_;
+        AltyTraits::construct(allocator_, target, std::forward<Args>(args)...);
+        ++tail_;
+        return *target;
+    }
+
+    void pop_back() {
+        ensure_not_empty();
+        truncate(size() - 1);
+    }
+
+    /// Appends `count` copies of `value`. If a copy throws, the list is
+    /// left as it was.
+    void append(const size_type count, const Type& value) {
+        append_n(count, [this, &value](pointer out) {
+            AltyTraits::construct(allocator_, out, value);
+        });
+    }
+
+    /// Appends `[first, last)`. If a copy throws, the list is left as it
+    /// was.
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    void append(Iter first, Iter last,
+                typename std::enable_if<detail::IsIteratorV<Iter>,
+                                        std::true_type>::type /* */
+                = {}) {
+        append_range(first, last, detail::IterConcatenateType<Iter>{});
+    }
+
+    void resize(const size_type count) {
+        if (count < size()) {
+            truncate(count);
+            return;
+        }
+        append_n(count - size(), [this](pointer out) {
+            AltyTraits::construct(allocator_, out);
+        });
+    }
+
+    void resize(const size_type count, const Type& value) {
+        if (count < size()) {
+            truncate(count);
+            return;
+        }
+        append(count - size(), value);
+    }
+
+    /// Destroys every element, keeping the segments for reuse.
+    void clear() noexcept { truncate(0); }
+
+    /// Allocates the segments needed to hold `new_capacity` elements, so
+    /// appends up to there never allocate.
+    void reserve(const size_type new_capacity) {
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        while (capacity() < new_capacity) {
+            add_segment();
+        }
+    }
+
+    /// Frees the segments past the one holding the last element.
+    void shrink_to_fit() noexcept {
+        release_segments(
+            size() == 0 ? 0 : Segments::segment_of(size() - 1) + 1);
+    }
+
+    /// Calls `function(first, count)` for each contiguous run of elements
+    /// in index order, one per segment.
+    template <class Function>
+    void for_each_segment(Function function) {
+        visit_range(0, size(), function);
+    }
+
+    template <class Function>
+    void for_each_segment(Function function) const {
+        visit_range(0, size(),
+                    [&function](pointer first, const size_type count) {
+                        function(const_pointer(first), count);
+                    });
+    }
+
+    /// Copies every element into one contiguous ArrayList.
+    template <typename GrowthPolicy = GeometricGrowth<>>
+    AL_NODISCARD auto to_array_list() const
+        -> ArrayList<Type, Allocator, GrowthPolicy> {
+        ArrayList<Type, Allocator, GrowthPolicy> result(allocator_);
+        result.reserve(size());
+        for_each_segment([&result](const_pointer first, const size_type count) {
+            result.push_back(first, first + count);
+        });
+        return result;
+    }
+
+    /// Moves every element into one contiguous ArrayList, leaving this list
+    /// empty and without segments.
+    template <typename GrowthPolicy = GeometricGrowth<>>
+    auto freeze() -> ArrayList<Type, Allocator, GrowthPolicy> {
+        ArrayList<Type, Allocator, GrowthPolicy> result(allocator_);
+        const auto count = size();
+        result.append_with(count, [this, count](pointer out, size_type) {
+            visit_range(0, count, [this, &out](pointer first,
+                                               const size_type run) {
+                detail::relocate_n<AltyTraits>(first, run, out, allocator_,
+                                               RelocationTag{});
+                out += run;
+            });
+            return count;
+        });
+        set_size(0);
+        release_segments(0);
+        return result;
+    }
+
+    /// Swaps the segment tables. Iterators into either list are
+    /// invalidated; references and pointers are not.
+    void swap(SegmentedArrayList& other) noexcept {
+        using std::swap;
+        swap_allocator(other,
+                       typename AltyTraits::propagate_on_container_swap{});
+        swap(segments_, other.segments_);
+        swap(segment_count_, other.segment_count_);
+        swap(limit_index_, other.limit_index_);
+        swap(tail_, other.tail_);
+        swap(limit_, other.limit_);
+    }
+
+    friend void swap(SegmentedArrayList& self,
+                     SegmentedArrayList& that) noexcept {
+        self.swap(that);
+    }
+
+    friend auto operator==(const SegmentedArrayList& self,
+                           const SegmentedArrayList& that) -> bool {
+        return self.size() == that.size() and
+               std::equal(self.begin(), self.end(), that.begin());
+    }
+
+    friend auto operator!=(const SegmentedArrayList& self,
+                           const SegmentedArrayList& that) -> bool {
+        return not(self == that);
+    }
+
+   private:
+    using Segments = detail::Segments<FirstSegmentSize>;
+    using RelocationTag =
+        typename std::conditional<IsTriviallyRelocatable<Type>::value,
+                                  detail::RelocateByMemcpy,
+                                  detail::RelocateByMove>::type;
+
+    /// Walks elements a segment at a time, so stepping is a pointer
+    /// increment except when crossing into the next segment. Every position
+    /// has exactly one cursor, so comparing for equality compares cursors.
+    template <bool Const>
+    class Iterator {
+       public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = typename SegmentedArrayList::difference_type;
+        using pointer =
+            typename std::conditional<Const, const Type*, Type*>::type;
+        using reference =
+            typename std::conditional<Const, const Type&, Type&>::type;
+
+        Iterator() noexcept = default;
+
+        template <bool OtherConst,
+                  typename std::enable_if<Const and not OtherConst,
+                                          int>::type = 0>
+        Iterator(const Iterator<OtherConst>& other) noexcept  // NOLINT
+            : segments_(other.segments_), cursor_(other.cursor_),
+              limit_(other.limit_), limit_index_(other.limit_index_) {}
+
+        AL_NODISCARD auto operator*() const noexcept -> reference {
+            return *cursor_;
+        }
+
+        AL_NODISCARD auto operator->() const noexcept -> pointer {
+            return cursor_;
+        }
+
+        AL_NODISCARD auto operator[](const difference_type offset) const
+            noexcept -> reference {
+            return *(*this + offset);
+        }
+
+        auto operator++() noexcept -> Iterator& {
+            if (++cursor_ == limit_) {
+                seek(limit_index_);
+            }
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> Iterator {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        auto operator--() noexcept -> Iterator& {
+            seek(index() - 1);
+            return *this;
+        }
+
+        auto operator--(int) noexcept -> Iterator {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        auto operator+=(const difference_type offset) noexcept -> Iterator& {
+            seek(index() + static_cast<size_type>(offset));
+            return *this;
+        }
+
+        auto operator-=(const difference_type offset) noexcept -> Iterator& {
+            return *this += -offset;
+        }
+
+        AL_NODISCARD friend auto operator+(
+            Iterator self, const difference_type offset) noexcept -> Iterator {
+            return self += offset;
+        }
+
+        AL_NODISCARD friend auto operator+(const difference_type offset,
+                                           Iterator self) noexcept -> Iterator {
+            return self += offset;
+        }
+
+        AL_NODISCARD friend auto operator-(
+            Iterator self, const difference_type offset) noexcept -> Iterator {
+            return self -= offset;
+        }
+
+        AL_NODISCARD friend auto operator-(const Iterator& self,
+                                           const Iterator& that) noexcept
+            -> difference_type {
+            return static_cast<difference_type>(self.index() - that.index());
+        }
+
+        AL_NODISCARD friend auto operator==(const Iterator& self,
+                                            const Iterator& that) noexcept
+            -> bool {
+            return self.cursor_ == that.cursor_;
+        }
+
+        AL_NODISCARD friend auto operator!=(const Iterator& self,
+                                            const Iterator& that) noexcept
+            -> bool {
+            return self.cursor_ != that.cursor_;
+        }
+
+        AL_NODISCARD friend auto operator<(const Iterator& self,
+                                           const Iterator& that) noexcept
+            -> bool {
+            return self.index() < that.index();
+        }
+
+        AL_NODISCARD friend auto operator>(const Iterator& self,
+                                           const Iterator& that) noexcept
+            -> bool {
+            return that < self;
+        }
+
+        AL_NODISCARD friend auto operator<=(const Iterator& self,
+                                            const Iterator& that) noexcept
+            -> bool {
+            return not(that < self);
+        }
+
+        AL_NODISCARD friend auto operator>=(const Iterator& self,
+                                            const Iterator& that) noexcept
+            -> bool {
+            return not(self < that);
+        }
+
+       private:
+        friend class SegmentedArrayList;
+        friend class Iterator<not Const>;
+
+        Iterator(const Type* const* segments, const size_type index) noexcept
+            : segments_(segments) {
+            seek(index);
+        }
+
+        auto index() const noexcept -> size_type {
+            return limit_index_ - static_cast<size_type>(limit_ - cursor_);
+        }
+
+        /// Points the cursor at `index`. Past the last segment, which only
+        /// the end iterator reaches, it points nowhere.
+        void seek(const size_type index) noexcept {
+            const auto segment = Segments::segment_of(index);
+            const auto first = const_cast<pointer>(
+                segment < Segments::Count ? segments_[segment] : nullptr);
+            if (first == nullptr) {
+                cursor_ = limit_ = nullptr;
+                limit_index_ = index;
+                return;
+            }
+            cursor_ = first + (index - Segments::start_of(segment));
+            limit_ = first + Segments::size_of(segment);
+            limit_index_ =
+                Segments::start_of(segment) + Segments::size_of(segment);
+        }
+
+        const Type* const* segments_ = nullptr;
+        pointer cursor_ = nullptr;
+        pointer limit_ = nullptr;
+        // The index `limit_` stands for.
+        size_type limit_index_ = 0;
+    };
+
+    /// Moves the tail into the segment after the full one, adding it if it
+    /// is not there yet.
+    void next_segment() {
+        const auto count = size();
+        if (count == capacity()) {
+            add_segment();
+        }
+        set_size(count);
+    }
+
+    /// Points the tail at slot `count` and the limit at the end of its
+    /// segment, or both nowhere when every segment is full.
+    void set_size(const size_type count) noexcept {
+        if (count == capacity()) {
+            tail_ = limit_ = nullptr;
+            limit_index_ = count;
+            return;
+        }
+        const auto segment = Segments::segment_of(count);
+        const auto first = segments_[segment];
+        tail_ = first + (count - Segments::start_of(segment));
+        limit_ = first + Segments::size_of(segment);
+        limit_index_ = Segments::start_of(segment) + Segments::size_of(segment);
+    }
+
+    auto slot(const size_type index) const noexcept -> pointer {
+        const auto segment = Segments::segment_of(index);
+        return segments_[segment] + (index - Segments::start_of(segment));
+    }
+
+    void add_segment() {
+        if (capacity() >= max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        segments_[segment_count_] = AltyTraits::allocate(
+            allocator_, Segments::size_of(segment_count_));
+        ++segment_count_;
+    }
+
+    /// Frees the segments from `first` on, which must hold no elements.
+    void release_segments(const size_type first) noexcept {
+        const auto count = size();
+        while (segment_count_ > first) {
+            --segment_count_;
+            AltyTraits::deallocate(allocator_, segments_[segment_count_],
+                                   Segments::size_of(segment_count_));
+            segments_[segment_count_] = nullptr;
+        }
+        set_size(count);
+    }
+
+    /// Calls `function(first, count)` for the contiguous runs of elements
+    /// [start, start + count), one per segment.
+    template <class Function>
+    void visit_range(size_type start, size_type count,
+                     Function&& function) const {
+        while (count > 0) {
+            const auto segment = Segments::segment_of(start);
+            const auto offset = start - Segments::start_of(segment);
+            const auto run =
+                std::min(count, Segments::size_of(segment) - offset);
+            function(segments_[segment] + offset, run);
+            start += run;
+            count -= run;
+        }
+    }
+
+    void truncate(const size_type count) noexcept {
+        destroy(count, size() - count);
+        set_size(count);
+    }
+
+    void destroy(const size_type start, const size_type count) noexcept {
+        visit_range(start, count, [this](pointer first, const size_type run) {
+            detail::destruct_all_elements<AltyTraits>(first, first + run,
+                                                      allocator_);
+        });
+    }
+
+    /// Makes room for `count` more elements and has `construct(slot)` build
+    /// them in order, a segment at a time. Anything built is destroyed
+    /// again if it throws.
+    template <class Construct>
+    void append_n(const size_type count, Construct construct) {
+        const auto old_size = size();
+        if (count > max_size() - old_size) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        reserve(old_size + count);
+        size_type built = 0;
+        try {
+            visit_range(old_size, count,
+                        [&construct, &built](pointer first, size_type run) {
+                            for (size_type i = 0; i < run; ++i, ++built) {
+                                construct(first + i);
+                            }
+                        });
+        } catch (...) {
+            destroy(old_size, built);
+            throw;
+        }
+        set_size(old_size + count);
+    }
+
+    template <typename Iter>
+    void append_range(Iter first, Iter last, std::forward_iterator_tag) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        append_n(count, [this, &first](pointer out) {
+            AltyTraits::construct(allocator_, out, *first);
+            ++first;
+        });
+    }
+
+    template <typename Iter>
+    void append_range(Iter first, Iter last, std::input_iterator_tag) {
+        const auto old_size = size();
+        try {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            truncate(old_size);
+            throw;
+        }
+    }
+
+    void steal(SegmentedArrayList& other) noexcept {
+        std::copy(std::begin(other.segments_), std::end(other.segments_),
+                  std::begin(segments_));
+        std::fill(std::begin(other.segments_), std::end(other.segments_),
+                  nullptr);
+        segment_count_ = other.segment_count_;
+        tail_ = other.tail_;
+        limit_ = other.limit_;
+        limit_index_ = other.limit_index_;
+        other.segment_count_ = 0;
+        other.tail_ = other.limit_ = nullptr;
+        other.limit_index_ = 0;
+    }
+
+    void copy_assign(const SegmentedArrayList& other) {
+        if (AltyTraits::propagate_on_container_copy_assignment::value and
+            allocator_ != other.allocator_) {
+            // The segments have to go back to the allocator that made them.
+            clear();
+            release_segments(0);
+        }
+        copy_allocator(
+            other,
+            typename AltyTraits::propagate_on_container_copy_assignment{});
+
+        // Assign over the live elements and keep the segments.
+        const auto common = other.begin() + static_cast<difference_type>(
+                                                std::min(size(), other.size()));
+        std::copy(other.begin(), common, begin());
+        if (other.size() < size()) {
+            truncate(other.size());
+        } else {
+            append(common, other.end());
+        }
+    }
+
+    void copy_allocator(const SegmentedArrayList& other, std::true_type) {
+        allocator_ = other.allocator_;
+    }
+
+    void copy_allocator(const SegmentedArrayList& /* other */,
+                        std::false_type) noexcept {}
+
+    void move_assign(SegmentedArrayList& other, std::true_type) noexcept {
+        clear();
+        release_segments(0);
+        allocator_ = std::move(other.allocator_);
+        steal(other);
+    }
+
+    void move_assign(SegmentedArrayList& other, std::false_type) {
+        if (allocator_ == other.allocator_) {
+            clear();
+            release_segments(0);
+            steal(other);
+            return;
+        }
+        // The other list's segments cannot be handed over, so its elements
+        // are moved one by one instead.
+        clear();
+        append(std::make_move_iterator(other.begin()),
+               std::make_move_iterator(other.end()));
+        other.clear();
+    }
+
+    void swap_allocator(SegmentedArrayList& other, std::true_type) noexcept {
+        using std::swap;
+        swap(allocator_, other.allocator_);
+    }
+
+    void swap_allocator(SegmentedArrayList& /* other */,
+                        std::false_type) noexcept {}
+
+    void ensure_in_range(const size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    void ensure_not_empty() const {
+        if (empty()) {
+            throw std::out_of_range("ArrayList is empty");
+        }
+    }
+
+    Alty allocator_;
+    pointer segments_[Segments::Count] = {};
+    size_type segment_count_ = 0;
+    // Where the next element goes and the end of its segment, so appending
+    // is a pointer bump like in ArrayList. The size is worked out from them
+    // rather than counted, which would cost a store on every append.
+    pointer tail_ = nullptr;
+    pointer limit_ = nullptr;
+    size_type limit_index_ = 0;
+};
+
+}  // namespace al
+
+#endif  // SEGMENTED_ARRAY_LIST_HPP
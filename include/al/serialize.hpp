@@ -0,0 +1,404 @@
+#ifndef SERIALIZE_HPP
+#define SERIALIZE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "array_list.hpp"
+#include "detail/io.hpp"
+
+namespace al {
+
+/// Thrown when serialized input is not a list of the expected type, or is
+/// damaged or cut short.
+class SerializationError : public std::runtime_error {
+   public:
+    using std::runtime_error::runtime_error;
+};
+
+/// Appends encoded elements to a byte buffer.
+class ByteWriter {
+   public:
+    explicit ByteWriter(ArrayList<unsigned char>& buffer) noexcept
+        : buffer_(&buffer) {}
+
+    void write(const void* const data, const size_t bytes) {
+        buffer_->append_with(bytes,
+                             [data, bytes](unsigned char* tail, size_t) {
+                                 std::memcpy(tail, data, bytes);
+                                 return bytes;
+                             });
+    }
+
+    template <class Value>
+    void put(const Value& value) {
+        static_assert(std::is_trivially_copyable<Value>::value,
+                      "Requires a trivially copyable value to copy as bytes");
+        write(std::addressof(value), sizeof(Value));
+    }
+
+   private:
+    ArrayList<unsigned char>* buffer_;
+};
+
+/// Reads encoded elements back from a byte buffer, throwing
+/// `SerializationError` rather than reading past its end.
+class ByteReader {
+   public:
+    ByteReader(const unsigned char* const data, const size_t size) noexcept
+        : cursor_(data), end_(data + size) {}
+
+    void read(void* const data, const size_t bytes) {
+        std::memcpy(data, take(bytes), bytes);
+    }
+
+    template <class Value>
+    auto get() -> Value {
+        static_assert(std::is_trivially_copyable<Value>::value and
+                          std::is_default_constructible<Value>::value,
+                      "Requires a trivially copyable value to copy as bytes");
+        Value value;
+        read(std::addressof(value), sizeof(Value));
+        return value;
+    }
+
+    /// Hands out the next `bytes` bytes in place.
+    auto take(const size_t bytes) -> const unsigned char* {
+        if (bytes > remaining()) {
+            throw SerializationError("Serialized element is cut short");
+        }
+        const auto* const first = cursor_;
+        cursor_ += bytes;
+        return first;
+    }
+
+    AL_NODISCARD auto remaining() const noexcept -> size_t {
+        return static_cast<size_t>(end_ - cursor_);
+    }
+
+   private:
+    const unsigned char* cursor_;
+    const unsigned char* end_;
+};
+
+/// Encodes elements that cannot be copied as bytes. A codec provides
+/// `encode(ByteWriter&, const Type&)` and `decode(ByteReader&) -> Type`;
+/// specialize `Codec` or pass one to `serialize` and `deserialize`.
+template <class Type, class = void>
+struct Codec;
+
+template <class Type>
+struct Codec<Type, typename std::enable_if<
+                       std::is_trivially_copyable<Type>::value and
+                       std::is_default_constructible<Type>::value>::type> {
+    void encode(ByteWriter& out, const Type& value) const { out.put(value); }
+
+    auto decode(ByteReader& in) const -> Type { return in.get<Type>(); }
+};
+
+template <class Char, class Traits, class Allocator>
+struct Codec<std::basic_string<Char, Traits, Allocator>> {
+    using String = std::basic_string<Char, Traits, Allocator>;
+
+    void encode(ByteWriter& out, const String& value) const {
+        out.put(static_cast<std::uint64_t>(value.size()));
+        out.write(value.data(), value.size() * sizeof(Char));
+    }
+
+    auto decode(ByteReader& in) const -> String {
+        const auto length = in.get<std::uint64_t>();
+        if (length > in.remaining() / sizeof(Char)) {
+            throw SerializationError("Serialized element is cut short");
+        }
+        String value(static_cast<size_t>(length), Char());
+        in.read(&value[0], value.size() * sizeof(Char));
+        return value;
+    }
+};
+
+namespace detail {
+
+/// Precedes every serialized list. Written in the byte order of the writer;
+/// a reader with another byte order rejects it.
+struct SerialHeader {
+    static constexpr char Magic[4] = {'A', 'L', 'S', 'T'};
+    static constexpr std::uint8_t Version = 1;
+    static constexpr std::uint8_t Raw = 0;
+    static constexpr std::uint8_t Encoded = 1;
+
+    char magic[4];
+    std::uint8_t version;
+    std::uint8_t byte_order;
+    std::uint8_t encoding;
+    std::uint8_t reserved;
+    std::uint32_t element_size;
+    std::uint32_t element_alignment;
+    std::uint64_t count;
+    std::uint64_t bytes;
+    std::uint64_t checksum;
+};
+
+/// 1 on little endian machines, 2 on big endian ones.
+inline auto native_byte_order() noexcept -> std::uint8_t {
+    const std::uint16_t probe = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? 1 : 2;
+}
+
+inline auto rotate_left(const std::uint64_t value, const unsigned bits) noexcept
+    -> std::uint64_t {
+    return (value << bits) | (value >> (64U - bits));
+}
+
+/// A 64-bit checksum built from xxHash's round, four words at a time so the
+/// rounds overlap, fast enough not to show next to the I/O.
+inline auto checksum(const void* const data, const size_t size) noexcept
+    -> std::uint64_t {
+    constexpr std::uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t Prime3 = 0x165667B19E3779F9ULL;
+    const auto round = [](const std::uint64_t acc, const std::uint64_t word) {
+        return rotate_left(acc + word * Prime2, 31) * Prime1;
+    };
+    const auto* const bytes = static_cast<const unsigned char*>(data);
+
+    std::uint64_t lanes[4] = {Prime1 + Prime2, Prime2, 0, 0 - Prime1};
+    size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + offset + lane * 8, 8);
+            lanes[lane] = round(lanes[lane], word);
+        }
+    }
+    auto hash = rotate_left(lanes[0], 1) + rotate_left(lanes[1], 7) +
+                rotate_left(lanes[2], 12) + rotate_left(lanes[3], 18) +
+                static_cast<std::uint64_t>(size);
+    for (; offset + 8 <= size; offset += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + offset, 8);
+        hash = rotate_left(hash ^ round(0, word), 27) * Prime1 + Prime3;
+    }
+    for (; offset < size; ++offset) {
+        hash = rotate_left(hash ^ (bytes[offset] * Prime3), 11) * Prime1;
+    }
+    hash ^= hash >> 33U;
+    hash *= Prime2;
+    hash ^= hash >> 29U;
+    hash *= Prime3;
+    return hash ^ (hash >> 32U);
+}
+
+template <class Type>
+auto make_header(const std::uint8_t encoding, const size_t count,
+                 const void* const payload, const size_t bytes) noexcept
+    -> SerialHeader {
+    SerialHeader header{};
+    std::memcpy(header.magic, SerialHeader::Magic, sizeof(header.magic));
+    header.version = SerialHeader::Version;
+    header.byte_order = native_byte_order();
+    header.encoding = encoding;
+    header.element_size = static_cast<std::uint32_t>(sizeof(Type));
+    header.element_alignment = static_cast<std::uint32_t>(alignof(Type));
+    header.count = count;
+    header.bytes = bytes;
+    header.checksum = checksum(payload, bytes);
+    return header;
+}
+
+template <class Type, class Source>
+auto read_header(Source& source, const std::uint8_t encoding)
+    -> SerialHeader {
+    SerialHeader header;
+    if (read_up_to(source, &header, sizeof(header)) != sizeof(header) or
+        std::memcmp(header.magic, SerialHeader::Magic,
+                    sizeof(header.magic)) != 0) {
+        throw SerializationError("Not a serialized ArrayList");
+    }
+    if (header.version != SerialHeader::Version) {
+        throw SerializationError("Unsupported serialized ArrayList version");
+    }
+    if (header.byte_order != native_byte_order()) {
+        throw SerializationError("Serialized with another byte order");
+    }
+    if (header.encoding != encoding or
+        header.element_size != sizeof(Type) or
+        header.element_alignment != alignof(Type)) {
+        throw SerializationError("Serialized elements are of another type");
+    }
+    return header;
+}
+
+/// Payload asked of a source that cannot tell its size, at first; the chunk
+/// doubles as the data arrives.
+constexpr size_t PayloadChunkBytes = size_t{1} << 20U;
+
+/// Appends the payload of `header` to `list` and checks it. The header is
+/// not trusted to size an allocation: a source that knows its size must
+/// hold the whole payload before it is read in one go, and any other is
+/// read in chunks, so a damaged count fails once the input ends rather
+/// than by allocating for it.
+template <class Source, class List>
+void read_payload(Source& source, List& list, const SerialHeader& header) {
+    using Type = typename List::value_type;
+    const auto remaining = remaining_size(source);
+    if (remaining and *remaining < header.bytes) {
+        throw SerializationError("Serialized ArrayList is cut short");
+    }
+    const auto before = list.size();
+    const auto total = static_cast<size_t>(header.bytes / sizeof(Type));
+    size_t chunk = remaining ? total
+                             : (PayloadChunkBytes > sizeof(Type)
+                                    ? PayloadChunkBytes / sizeof(Type)
+                                    : 1);
+    for (size_t done = 0; done < total; done += chunk, chunk *= 2) {
+        chunk = total - done < chunk ? total - done : chunk;
+        size_t bytes = 0;
+        // Straight into the uninitialized tail, with no construction first.
+        list.append_with(chunk, [&](Type* const tail, size_t) {
+            bytes = read_up_to(source, tail, chunk * sizeof(Type));
+            return bytes / sizeof(Type);
+        });
+        if (bytes != chunk * sizeof(Type)) {
+            throw SerializationError("Serialized ArrayList is cut short");
+        }
+    }
+    if (checksum(list.data() + before, static_cast<size_t>(header.bytes)) !=
+        header.checksum) {
+        throw SerializationError("Serialized ArrayList is damaged");
+    }
+}
+
+template <class Sink, class List>
+void serialize_raw(Sink& sink, const List& list) {
+    using Type = typename List::value_type;
+    const auto bytes = list.size() * sizeof(Type);
+    const auto header = make_header<Type>(SerialHeader::Raw, list.size(),
+                                          list.data(), bytes);
+    const ByteSpan spans[] = {{&header, sizeof(header)}, {list.data(), bytes}};
+    write_all(sink, spans);
+}
+
+template <class Source, class List>
+void deserialize_raw(Source& source, List& list) {
+    using Type = typename List::value_type;
+    const auto header = read_header<Type>(source, SerialHeader::Raw);
+    if (header.count > list.max_size() or
+        header.bytes != header.count * sizeof(Type)) {
+        throw SerializationError("Serialized ArrayList has a bad size");
+    }
+    list.clear();
+    read_payload(source, list, header);
+}
+
+template <class Sink, class List, class ElementCodec>
+void serialize_encoded(Sink& sink, const List& list,
+                       const ElementCodec& codec) {
+    using Type = typename List::value_type;
+    ArrayList<unsigned char> buffer;
+    ByteWriter out(buffer);
+    for (const auto& value : list) {
+        codec.encode(out, value);
+    }
+    const auto header = make_header<Type>(SerialHeader::Encoded, list.size(),
+                                          buffer.data(), buffer.size());
+    const ByteSpan spans[] = {{&header, sizeof(header)},
+                              {buffer.data(), buffer.size()}};
+    write_all(sink, spans);
+}
+
+template <class Source, class List, class ElementCodec>
+void deserialize_encoded(Source& source, List& list,
+                         const ElementCodec& codec) {
+    using Type = typename List::value_type;
+    const auto header = read_header<Type>(source, SerialHeader::Encoded);
+    if (header.count > list.max_size() or header.bytes > PTRDIFF_MAX) {
+        throw SerializationError("Serialized ArrayList has a bad size");
+    }
+    ArrayList<unsigned char> buffer;
+    read_payload(source, buffer, header);
+
+    ByteReader in(buffer.data(), buffer.size());
+    list.clear();
+    // Elements of a few bytes each; a count beyond the payload is damage
+    // that decoding will catch, and should not allocate first.
+    list.reserve(static_cast<size_t>(
+        header.count < header.bytes ? header.count : header.bytes));
+    for (std::uint64_t index = 0; index < header.count; ++index) {
+        list.push_back(codec.decode(in));
+    }
+    if (in.remaining() != 0) {
+        throw SerializationError("Serialized ArrayList has trailing bytes");
+    }
+}
+
+}  // namespace detail
+
+/// Writes `list` to `sink`, a `std::ostream`, a `std::FILE*` or a
+/// `FileDescriptor`, behind a header recording the element type's size and
+/// alignment, the count, the byte order and a checksum. Trivially copyable
+/// elements go out as they are in memory, in a single `writev` for a file
+/// descriptor; anything else goes through `Codec<Type>`.
+template <class Sink, typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+void serialize(Sink&& sink,
+               const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>&
+                   list) {
+    if constexpr (std::is_trivially_copyable<Type>::value) {
+        detail::serialize_raw(sink, list);
+    } else {
+        detail::serialize_encoded(sink, list, Codec<Type>{});
+    }
+}
+
+/// Writes `list` with every element encoded by `codec`.
+template <class Sink, typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy, class ElementCodec>
+void serialize(Sink&& sink,
+               const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>&
+                   list,
+               const ElementCodec& codec) {
+    detail::serialize_encoded(sink, list, codec);
+}
+
+/// Replaces the contents of `list` with a list written by `serialize`.
+/// Trivially copyable elements are read straight into the list's
+/// uninitialized storage. Throws `SerializationError` for input that is not
+/// a list of `Type` from a machine of the same byte order, or that is
+/// damaged, and leaves `list` empty.
+template <class Source, typename Type, typename Allocator,
+          typename GrowthPolicy, typename StatsPolicy>
+void deserialize(Source&& source,
+                 ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list) {
+    try {
+        if constexpr (std::is_trivially_copyable<Type>::value) {
+            detail::deserialize_raw(source, list);
+        } else {
+            detail::deserialize_encoded(source, list, Codec<Type>{});
+        }
+    } catch (...) {
+        list.clear();
+        throw;
+    }
+}
+
+/// Reads a list written with `codec`.
+template <class Source, typename Type, typename Allocator,
+          typename GrowthPolicy, typename StatsPolicy, class ElementCodec>
+void deserialize(Source&& source,
+                 ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+                 const ElementCodec& codec) {
+    try {
+        detail::deserialize_encoded(source, list, codec);
+    } catch (...) {
+        list.clear();
+        throw;
+    }
+}
+
+}  // namespace al
+
+#endif  // SERIALIZE_HPP
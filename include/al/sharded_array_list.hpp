@@ -0,0 +1,201 @@
+#ifndef SHARDED_ARRAY_LIST_HPP
+#define SHARDED_ARRAY_LIST_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "array_list.hpp"
+#include "parallel.hpp"
+
+namespace al {
+
+namespace detail {
+
+inline auto next_sharded_id() noexcept -> std::uint64_t {
+    static std::atomic<std::uint64_t> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// The shard a thread used last, so repeated `local()` calls skip the lock.
+struct LocalShard {
+    std::uint64_t owner;
+    void* shard;
+};
+
+inline auto local_shard() noexcept -> LocalShard& {
+    thread_local LocalShard cache{0, nullptr};
+    return cache;
+}
+
+}  // namespace detail
+
+/// Per-thread ArrayLists merged into one at the end. Producers append to
+/// their own shard without any sharing, and `merge` sizes the result once
+/// and fills it from all shards in parallel.
+///
+/// Shards are numbered and merged in index order. `shard(index)` hands out
+/// a shard by index, for output that must keep a known order; `local()`
+/// hands every thread its own shard, numbered as threads first ask.
+/// Creating shards is thread-safe. Merging, clearing and `size()` must not
+/// race with producers.
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = GeometricGrowth<>>
+AL_REQUIRES(std::is_object<Type>::value)
+class ShardedArrayList {
+   public:
+    using shard_type = ArrayList<Type, Allocator, GrowthPolicy>;
+    using value_type = Type;
+    using allocator_type = typename shard_type::allocator_type;
+    using size_type = typename shard_type::size_type;
+
+    ShardedArrayList() = default;
+
+    explicit ShardedArrayList(const allocator_type& alloc)
+        : allocator_(alloc) {}
+
+    ShardedArrayList(const ShardedArrayList&) = delete;
+    auto operator=(const ShardedArrayList&) -> ShardedArrayList& = delete;
+
+    /// The calling thread's shard.
+    AL_NODISCARD auto local() -> shard_type& {
+        auto& cache = detail::local_shard();
+        if (cache.owner == id_) {
+            return static_cast<Shard*>(cache.shard)->list;
+        }
+
+        const auto thread = std::this_thread::get_id();
+        const std::lock_guard<std::mutex> lock(mutex_);
+        Shard* found = nullptr;
+        for (auto& shard : shards_) {
+            if (shard->owner == thread) {
+                found = shard.get();
+                break;
+            }
+        }
+        if (found == nullptr) {
+            found = add_shard();
+            found->owner = thread;
+        }
+        cache = detail::LocalShard{id_, found};
+        return found->list;
+    }
+
+    /// The shard at `index`, creating it and any before it as needed.
+    AL_NODISCARD auto shard(const size_type index) -> shard_type& {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        while (shards_.size() <= index) {
+            add_shard();
+        }
+        return shards_[index]->list;
+    }
+
+    AL_NODISCARD auto shard_count() const -> size_type {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return shards_.size();
+    }
+
+    /// The number of elements across all shards.
+    AL_NODISCARD auto size() const -> size_type {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        size_type total = 0;
+        for (const auto& shard : shards_) {
+            total += shard->list.size();
+        }
+        return total;
+    }
+
+    AL_NODISCARD auto empty() const -> bool { return size() == 0; }
+
+    /// Clears every shard, keeping their capacity for the next round.
+    void clear() noexcept {
+        for (auto& shard : shards_) {
+            shard->list.clear();
+        }
+    }
+
+    /// Moves every element, shard by shard in index order, to the end of
+    /// `output`, which grows at most once. The shards are left empty with
+    /// their capacity kept.
+    template <typename OutputAllocator, typename OutputGrowth,
+              typename OutputStats>
+    void merge_into(
+        ArrayList<Type, OutputAllocator, OutputGrowth, OutputStats>& output,
+        parallel::ThreadPool& pool = parallel::default_pool()) {
+        ArrayList<size_t> offsets;
+        offsets.reserve(shards_.size() + 1);
+        offsets.push_back(0);
+        for (const auto& shard : shards_) {
+            offsets.push_back(offsets.back() + shard->list.size());
+        }
+
+        output.reserve(output.size() + offsets.back());
+        move_shards(output, offsets, pool,
+                    std::is_trivially_copyable<Type>{});
+        clear();
+    }
+
+    /// Moves every element into a new contiguous ArrayList.
+    AL_NODISCARD auto merge(
+        parallel::ThreadPool& pool = parallel::default_pool()) -> shard_type {
+        shard_type result(allocator_);
+        merge_into(result, pool);
+        return result;
+    }
+
+   private:
+    // Shards are allocated one by one, so their headers never share a cache
+    // line with another thread's.
+    struct alignas(parallel::detail::CacheLine) Shard {
+        explicit Shard(const allocator_type& alloc) : list(alloc) {}
+
+        shard_type list;
+        std::thread::id owner;
+    };
+
+    auto add_shard() -> Shard* {
+        shards_.push_back(std::unique_ptr<Shard>(new Shard(allocator_)));
+        return shards_.back().get();
+    }
+
+    template <class Output>
+    void move_shards(Output& output, const ArrayList<size_t>& offsets,
+                     parallel::ThreadPool& pool,
+                     std::true_type /* trivially copyable */) {
+        const auto total = offsets.back();
+        output.append_with(total, [&](Type* const tail, size_t /* room */) {
+            pool.run(shards_.size(), [&](const size_t index) {
+                const auto& list = shards_[index]->list;
+                if (not list.empty()) {
+                    std::memcpy(static_cast<void*>(tail + offsets[index]),
+                                list.data(), list.size() * sizeof(Type));
+                }
+            });
+            return total;
+        });
+    }
+
+    template <class Output>
+    void move_shards(Output& output, const ArrayList<size_t>& offsets,
+                     parallel::ThreadPool& pool,
+                     std::false_type /* trivially copyable */) {
+        auto fill = [this](const size_t index, auto emit) {
+            for (auto& element : shards_[index]->list) {
+                emit(std::move_if_noexcept(element));
+            }
+        };
+        parallel::detail::append_chunks(output, offsets, pool, fill);
+    }
+
+    allocator_type allocator_;
+    const std::uint64_t id_ = detail::next_sharded_id();
+    mutable std::mutex mutex_;
+    ArrayList<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace al
+
+#endif  // SHARDED_ARRAY_LIST_HPP
@@ -0,0 +1,526 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+
+#include "array_list.hpp"
+
+#if (AL_GCC || AL_CLANG) && (defined(__x86_64__) || defined(__i386__))
+#define AL_HAS_SIMD_DISPATCH 1
+#else
+#define AL_HAS_SIMD_DISPATCH 0
+#endif
+
+namespace al {
+
+namespace simd {
+
+/// Instruction sets the algorithms below dispatch between, from worst to best.
+enum class Isa { Scalar, Sse2, Avx2, Avx512 };
+
+/// The best instruction set this CPU supports, detected once.
+inline auto detected_isa() noexcept -> Isa {
+    static const Isa isa = [] {
+#if AL_HAS_SIMD_DISPATCH
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") and
+            __builtin_cpu_supports("avx512bw") and
+            __builtin_cpu_supports("avx512dq")) {
+            return Isa::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return Isa::Avx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return Isa::Sse2;
+        }
+#endif
+        return Isa::Scalar;
+    }();
+    return isa;
+}
+
+namespace detail {
+
+inline auto isa_limit() noexcept -> std::atomic<Isa>& {
+    static std::atomic<Isa> limit{Isa::Avx512};
+    return limit;
+}
+
+}  // namespace detail
+
+/// Caps the instruction set used from now on, so tests and benchmarks can
+/// compare the code paths on one machine.
+inline void limit_isa(const Isa isa) noexcept {
+    detail::isa_limit().store(isa, std::memory_order_relaxed);
+}
+
+/// The instruction set the algorithms currently use.
+inline auto active_isa() noexcept -> Isa {
+    const auto limit = detail::isa_limit().load(std::memory_order_relaxed);
+    const auto detected = detected_isa();
+    return limit < detected ? limit : detected;
+}
+
+namespace detail {
+
+template <size_t Size, bool Signed>
+struct IntOfSize;
+
+template <>
+struct IntOfSize<1, true> {
+    using type = std::int8_t;  // NOLINT
+};
+template <>
+struct IntOfSize<2, true> {
+    using type = std::int16_t;  // NOLINT
+};
+template <>
+struct IntOfSize<4, true> {
+    using type = std::int32_t;  // NOLINT
+};
+template <>
+struct IntOfSize<8, true> {
+    using type = std::int64_t;  // NOLINT
+};
+template <>
+struct IntOfSize<1, false> {
+    using type = std::uint8_t;  // NOLINT
+};
+template <>
+struct IntOfSize<2, false> {
+    using type = std::uint16_t;  // NOLINT
+};
+template <>
+struct IntOfSize<4, false> {
+    using type = std::uint32_t;  // NOLINT
+};
+template <>
+struct IntOfSize<8, false> {
+    using type = std::uint64_t;  // NOLINT
+};
+
+/// The vector lane type sharing the representation and ordering of `Type`,
+/// for the element types the kernels support.
+template <class Type, class = void>
+struct LaneOf {};
+
+template <class Type>
+struct LaneOf<Type, typename std::enable_if<
+                        std::is_integral<Type>::value and
+                        !std::is_same<Type, bool>::value and
+                        (sizeof(Type) == 1 or sizeof(Type) == 2 or
+                         sizeof(Type) == 4 or sizeof(Type) == 8)>::type> {
+    using type =  // NOLINT
+        typename IntOfSize<sizeof(Type), std::is_signed<Type>::value>::type;
+};
+
+template <>
+struct LaneOf<float> {
+    using type = float;  // NOLINT
+};
+
+template <>
+struct LaneOf<double> {
+    using type = double;  // NOLINT
+};
+
+template <class Type, class = void>
+struct IsVectorizable : std::false_type {};
+
+template <class Type>
+struct IsVectorizable<Type, al::detail::VoidT<typename LaneOf<Type>::type>>
+    : std::true_type {};
+
+/// Integer sums wrap around, which only unsigned arithmetic does portably.
+template <class Lane>
+using SumLane = typename std::conditional<
+    std::is_integral<Lane>::value,
+    typename IntOfSize<sizeof(Lane), false>::type, Lane>::type;
+
+#if AL_HAS_SIMD_DISPATCH
+
+#define AL_SIMD_INLINE inline __attribute__((always_inline))
+
+template <class Lane, size_t Width>
+struct VectorOf {
+    typedef Lane type __attribute__((vector_size(Width)));  // NOLINT
+    /// For loads from element pointers, which are neither aligned to the
+    /// vector nor of the vector's type.
+    typedef Lane unaligned  // NOLINT
+        __attribute__((vector_size(Width), aligned(alignof(Lane)), may_alias));
+};
+
+/// The lanes of `Lane` that fit in a `Width` byte register, with the type
+/// comparisons produce.
+template <class Lane, size_t Width>
+struct Vec {
+    static constexpr size_t Lanes = Width / sizeof(Lane);
+
+    using type = typename VectorOf<Lane, Width>::type;  // NOLINT
+    using mask = typename VectorOf<  // NOLINT
+        typename IntOfSize<sizeof(Lane), true>::type, Width>::type;
+
+    // Vectors are passed and returned through references, which keeps the
+    // ABI of the wider vectors out of the picture.
+    static AL_SIMD_INLINE void load(type& result,
+                                    const Lane* const data) noexcept {
+        using Unaligned = typename VectorOf<Lane, Width>::unaligned;
+        result = *reinterpret_cast<const Unaligned*>(data);  // NOLINT
+    }
+
+    static AL_SIMD_INLINE void splat(type& result, const Lane value) noexcept {
+        for (size_t lane = 0; lane < Lanes; ++lane) {
+            result[lane] = value;
+        }
+    }
+
+    static AL_SIMD_INLINE auto any(const mask& value) noexcept -> bool {
+        return fold_or<Width>(value);
+    }
+
+    // Folds halves together in registers, down to two 64 bit words. A round
+    // trip through memory would stall on store forwarding.
+    template <size_t Bytes, class Vector>
+    static AL_SIMD_INLINE auto fold_or(const Vector& value) noexcept ->
+        typename std::enable_if<(Bytes > 16), bool>::type {
+        using Half = typename VectorOf<std::uint64_t, Bytes / 2>::type;
+        Half low;
+        Half high;
+        std::memcpy(&low, &value, Bytes / 2);
+        std::memcpy(&high, reinterpret_cast<const char*>(&value) + Bytes / 2,
+                    Bytes / 2);
+        const Half combined = low | high;
+        return fold_or<Bytes / 2>(combined);
+    }
+
+    template <size_t Bytes, class Vector>
+    static AL_SIMD_INLINE auto fold_or(const Vector& value) noexcept ->
+        typename std::enable_if<(Bytes == 16), bool>::type {
+        using Words = typename VectorOf<std::uint64_t, 16>::type;
+        const auto words = (Words)value;  // NOLINT
+        return (words[0] | words[1]) != 0;
+    }
+
+    /// Replaces the lanes of `into` where `condition` is set.
+    static AL_SIMD_INLINE void blend(type& into, const mask& condition,
+                                     const type& values) noexcept {
+        into = (type)(((mask)values & condition) |  // NOLINT
+                      ((mask)into & ~condition));  // NOLINT
+    }
+};
+
+#define AL_SIMD_PRAGMA(...) _Pragma(#__VA_ARGS__)
+#if AL_CLANG
+#define AL_SIMD_BEGIN_TARGET(TARGET)                              \
+    AL_SIMD_PRAGMA(clang attribute push(                          \
+        __attribute__((target(TARGET))), apply_to = function))
+#define AL_SIMD_END_TARGET() AL_SIMD_PRAGMA(clang attribute pop)
+#else
+#define AL_SIMD_BEGIN_TARGET(TARGET) \
+    AL_SIMD_PRAGMA(GCC push_options) AL_SIMD_PRAGMA(GCC target(TARGET))
+#define AL_SIMD_END_TARGET() AL_SIMD_PRAGMA(GCC pop_options)
+#endif
+
+AL_SIMD_BEGIN_TARGET("sse2")
+#define AL_SIMD_KERNELS Sse2Kernels
+#define AL_SIMD_WIDTH 16
+#include "simd_kernels.hpp"  // IWYU pragma: keep
+#undef AL_SIMD_KERNELS
+#undef AL_SIMD_WIDTH
+AL_SIMD_END_TARGET()
+
+AL_SIMD_BEGIN_TARGET("avx2")
+#define AL_SIMD_KERNELS Avx2Kernels
+#define AL_SIMD_WIDTH 32
+#include "simd_kernels.hpp"  // IWYU pragma: keep
+#undef AL_SIMD_KERNELS
+#undef AL_SIMD_WIDTH
+AL_SIMD_END_TARGET()
+
+AL_SIMD_BEGIN_TARGET("avx512f,avx512bw,avx512dq")
+#define AL_SIMD_KERNELS Avx512Kernels
+#define AL_SIMD_WIDTH 64
+#include "simd_kernels.hpp"  // IWYU pragma: keep
+#undef AL_SIMD_KERNELS
+#undef AL_SIMD_WIDTH
+AL_SIMD_END_TARGET()
+
+#undef AL_SIMD_BEGIN_TARGET
+#undef AL_SIMD_END_TARGET
+#undef AL_SIMD_PRAGMA
+#undef AL_SIMD_INLINE
+
+#define AL_SIMD_DISPATCH(CALL)                  \
+    switch (active_isa()) {                     \
+        case Isa::Avx512:                       \
+            return Avx512Kernels::CALL;         \
+        case Isa::Avx2:                         \
+            return Avx2Kernels::CALL;           \
+        case Isa::Sse2:                         \
+            return Sse2Kernels::CALL;           \
+        case Isa::Scalar:                       \
+            break;                              \
+    }
+
+#else  // ^^^ AL_HAS_SIMD_DISPATCH / vvv !AL_HAS_SIMD_DISPATCH
+
+#define AL_SIMD_DISPATCH(CALL)
+
+#endif  // ^^^ !AL_HAS_SIMD_DISPATCH
+
+template <class Lane>
+auto find_lanes(const Lane* const data, const size_t size,
+                const Lane value) noexcept -> size_t {
+    AL_SIMD_DISPATCH(find(data, size, value))
+    return static_cast<size_t>(std::find(data, data + size, value) - data);
+}
+
+template <class Lane>
+auto count_lanes(const Lane* const data, const size_t size,
+                 const Lane value) noexcept -> size_t {
+    AL_SIMD_DISPATCH(count(data, size, value))
+    return static_cast<size_t>(std::count(data, data + size, value));
+}
+
+template <class Lane>
+auto mismatch_lanes(const Lane* const self, const Lane* const that,
+                    const size_t size) noexcept -> size_t {
+    AL_SIMD_DISPATCH(mismatch(self, that, size))
+    return static_cast<size_t>(std::mismatch(self, self + size, that).first -
+                               self);
+}
+
+template <bool Largest, class Lane>
+auto extreme_lanes(const Lane* const data, const size_t size) noexcept
+    -> Lane {
+    Lane result;
+    const auto vectorized = [&]() -> bool {
+        AL_SIMD_DISPATCH(template extreme<Largest>(data, size, result))
+        return false;
+    };
+    if (vectorized()) {
+        return result;
+    }
+    return Largest ? *std::max_element(data, data + size)
+                   : *std::min_element(data, data + size);
+}
+
+template <class Lane>
+auto sum_lanes(const Lane* const data, const size_t size) noexcept -> Lane {
+    AL_SIMD_DISPATCH(sum(data, size))
+    SumLane<Lane> total = 0;
+    for (size_t index = 0; index < size; ++index) {
+        total += static_cast<SumLane<Lane>>(data[index]);
+    }
+    return static_cast<Lane>(total);
+}
+
+#undef AL_SIMD_DISPATCH
+
+template <class Type>
+auto as_lanes(const Type* const data) noexcept ->
+    typename LaneOf<Type>::type const* {
+    // NOLINTNEXTLINE
+    return reinterpret_cast<typename LaneOf<Type>::type const*>(data);
+}
+
+template <class Type>
+auto index_of(const Type* const data, const size_t size, const Type& value,
+              std::true_type) noexcept -> size_t {
+    using Lane = typename LaneOf<Type>::type;
+    return find_lanes(as_lanes(data), size, static_cast<Lane>(value));
+}
+
+template <class Type>
+auto index_of(const Type* const data, const size_t size, const Type& value,
+              std::false_type) -> size_t {
+    return static_cast<size_t>(std::find(data, data + size, value) - data);
+}
+
+template <class Type>
+auto count_of(const Type* const data, const size_t size, const Type& value,
+              std::true_type) noexcept -> size_t {
+    using Lane = typename LaneOf<Type>::type;
+    return count_lanes(as_lanes(data), size, static_cast<Lane>(value));
+}
+
+template <class Type>
+auto count_of(const Type* const data, const size_t size, const Type& value,
+              std::false_type) -> size_t {
+    return static_cast<size_t>(std::count(data, data + size, value));
+}
+
+template <class Type>
+auto mismatch_of(const Type* const self, const Type* const that,
+                 const size_t size, std::true_type) noexcept -> size_t {
+    return mismatch_lanes(as_lanes(self), as_lanes(that), size);
+}
+
+template <class Type>
+auto mismatch_of(const Type* const self, const Type* const that,
+                 const size_t size, std::false_type) -> size_t {
+    return static_cast<size_t>(std::mismatch(self, self + size, that).first -
+                               self);
+}
+
+template <bool Largest, class Type>
+auto extreme_of(const Type* const data, const size_t size,
+                std::true_type) noexcept -> Type {
+    return static_cast<Type>(extreme_lanes<Largest>(as_lanes(data), size));
+}
+
+template <bool Largest, class Type>
+auto extreme_of(const Type* const data, const size_t size, std::false_type)
+    -> Type {
+    return Largest ? *std::max_element(data, data + size)
+                   : *std::min_element(data, data + size);
+}
+
+template <class Type>
+auto sum_of(const Type* const data, const size_t size,
+            std::true_type) noexcept -> Type {
+    return static_cast<Type>(sum_lanes(as_lanes(data), size));
+}
+
+template <class Type>
+auto sum_of(const Type* const data, const size_t size, std::false_type)
+    -> Type {
+    return std::accumulate(data, data + size, Type());
+}
+
+inline void ensure_not_empty(const size_t size) {
+    if (size == 0) {
+        throw std::out_of_range("ArrayList is empty");
+    }
+}
+
+}  // namespace detail
+
+// The algorithms below use SSE2, AVX2 or AVX-512 for integral, float and
+// double elements, and the standard algorithms for anything else.
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto find(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+          const Type& value) ->
+    typename ArrayList<Type, Allocator, GrowthPolicy,
+                       StatsPolicy>::const_iterator {
+    return list.begin() + detail::index_of(list.data(), list.size(), value,
+                                           detail::IsVectorizable<Type>{});
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto find(ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+          const Type& value) ->
+    typename ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>::iterator {
+    return list.begin() + detail::index_of(list.data(), list.size(), value,
+                                           detail::IsVectorizable<Type>{});
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto contains(
+    const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+    const Type& value) -> bool {
+    return simd::find(list, value) != list.end();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto count(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list,
+           const Type& value) -> size_t {
+    return detail::count_of(list.data(), list.size(), value,
+                            detail::IsVectorizable<Type>{});
+}
+
+/// The smallest element. Throws `std::out_of_range` for an empty list.
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto min(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list)
+    -> Type {
+    detail::ensure_not_empty(list.size());
+    return detail::extreme_of<false>(list.data(), list.size(),
+                                     detail::IsVectorizable<Type>{});
+}
+
+/// The largest element. Throws `std::out_of_range` for an empty list.
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto max(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list)
+    -> Type {
+    detail::ensure_not_empty(list.size());
+    return detail::extreme_of<true>(list.data(), list.size(),
+                                    detail::IsVectorizable<Type>{});
+}
+
+/// Integer sums wrap around. Floating point sums are added lane by lane, so
+/// rounding may differ from a sequential `std::accumulate`.
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto sum(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& list)
+    -> Type {
+    return detail::sum_of(list.data(), list.size(),
+                          detail::IsVectorizable<Type>{});
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto equal(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& self,
+           const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& that)
+    -> bool {
+    if (self.size() != that.size()) {
+        return false;
+    }
+    if (al::detail::IsBitwiseComparable<Type>::value) {
+        return al::detail::equal_n(self.data(), that.data(), self.size());
+    }
+    return detail::mismatch_of(self.data(), that.data(), self.size(),
+                               detail::IsVectorizable<Type>{}) == self.size();
+}
+
+/// Lexicographical three-way comparison, negative, zero or positive like
+/// `memcmp`. Elements that are unordered, such as NaNs, compare equivalent.
+template <typename Type, typename Allocator, typename GrowthPolicy,
+          typename StatsPolicy>
+auto compare(const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& self,
+             const ArrayList<Type, Allocator, GrowthPolicy, StatsPolicy>& that)
+    -> int {
+    const auto common = self.size() < that.size() ? self.size() : that.size();
+    if (al::detail::IsBytewiseOrdered<Type>::value and common != 0) {
+        const auto order = std::memcmp(self.data(), that.data(), common);
+        if (order != 0) {
+            return order;
+        }
+    } else {
+        size_t index = 0;
+        while (index != common) {
+            index += detail::mismatch_of(self.data() + index,
+                                         that.data() + index, common - index,
+                                         detail::IsVectorizable<Type>{});
+            if (index == common) {
+                break;
+            }
+            if (self[index] < that[index]) {
+                return -1;
+            }
+            if (that[index] < self[index]) {
+                return 1;
+            }
+            ++index;
+        }
+    }
+    if (self.size() == that.size()) {
+        return 0;
+    }
+    return self.size() < that.size() ? -1 : 1;
+}
+
+}  // namespace simd
+
+}  // namespace al
+
+#endif  // SIMD_HPP
@@ -0,0 +1,182 @@
+// Kernels for one instruction set. simd.hpp includes this once per target,
+// with AL_SIMD_KERNELS and AL_SIMD_WIDTH defined and the target enabled for
+// everything defined here. Comparisons have to be written inside the target:
+// their mask type is picked where they appear, and a mask picked without
+// AVX-512 would be split into scalar compares.
+
+// NOLINTBEGIN(bugprone-macro-parentheses)
+struct AL_SIMD_KERNELS {
+    static constexpr size_t Width = AL_SIMD_WIDTH;
+
+    template <class Lane>
+    static auto find(const Lane* const data, const size_t size,
+                     const Lane value) noexcept -> size_t {
+        using V = Vec<Lane, Width>;
+        constexpr auto Step = 4 * V::Lanes;
+        typename V::type needle;
+        V::splat(needle, value);
+
+        size_t index = 0;
+        for (; index + Step <= size; index += Step) {
+            typename V::type first;
+            typename V::type second;
+            typename V::type third;
+            typename V::type fourth;
+            V::load(first, data + index);
+            V::load(second, data + index + V::Lanes);
+            V::load(third, data + index + 2 * V::Lanes);
+            V::load(fourth, data + index + 3 * V::Lanes);
+            const typename V::mask hits =
+                (first == needle) | (second == needle) | (third == needle) |
+                (fourth == needle);
+            if (V::any(hits)) {
+                break;
+            }
+        }
+        for (; index < size; ++index) {
+            if (data[index] == value) {
+                return index;
+            }
+        }
+        return size;
+    }
+
+    template <class Lane>
+    static auto count(const Lane* const data, const size_t size,
+                      const Lane value) noexcept -> size_t {
+        using V = Vec<Lane, Width>;
+        using Counter = typename IntOfSize<sizeof(Lane), true>::type;
+        // Each lane counts up to its maximum before being flushed.
+        constexpr auto Flush = sizeof(Lane) == 1   ? size_t{127}
+                               : sizeof(Lane) == 2 ? size_t{32767}
+                                                   : size_t{1} << 30U;
+        typename V::type needle;
+        V::splat(needle, value);
+
+        size_t total = 0;
+        size_t index = 0;
+        while (index + V::Lanes <= size) {
+            typename V::mask counts = {};
+            for (size_t round = 0; round < Flush and index + V::Lanes <= size;
+                 ++round, index += V::Lanes) {
+                typename V::type values;
+                V::load(values, data + index);
+                counts -= values == needle;
+            }
+            Counter lanes[V::Lanes];
+            std::memcpy(lanes, &counts, Width);
+            for (const auto lane : lanes) {
+                total += static_cast<size_t>(lane);
+            }
+        }
+        for (; index < size; ++index) {
+            total += data[index] == value ? 1 : 0;
+        }
+        return total;
+    }
+
+    template <class Lane>
+    static auto mismatch(const Lane* const self, const Lane* const that,
+                         const size_t size) noexcept -> size_t {
+        using V = Vec<Lane, Width>;
+        constexpr auto Step = 2 * V::Lanes;
+
+        size_t index = 0;
+        for (; index + Step <= size; index += Step) {
+            typename V::type self_first;
+            typename V::type self_second;
+            typename V::type that_first;
+            typename V::type that_second;
+            V::load(self_first, self + index);
+            V::load(self_second, self + index + V::Lanes);
+            V::load(that_first, that + index);
+            V::load(that_second, that + index + V::Lanes);
+            const typename V::mask differences =
+                (self_first != that_first) | (self_second != that_second);
+            if (V::any(differences)) {
+                break;
+            }
+        }
+        for (; index < size; ++index) {
+            if (self[index] != that[index]) {
+                return index;
+            }
+        }
+        return size;
+    }
+
+    /// Writes the smallest (or largest) element to `result`. Returns false
+    /// without a result when a NaN makes the order ambiguous.
+    template <bool Largest, class Lane>
+    static auto extreme(const Lane* const data, const size_t size,
+                        Lane& result) noexcept -> bool {
+        using V = Vec<Lane, Width>;
+        if (size < V::Lanes) {
+            return false;
+        }
+
+        typename V::type best;
+        V::load(best, data);
+        typename V::mask nans = {};
+        for (size_t index = 0;; index += V::Lanes) {
+            // Overlapping the last full vector is harmless for an extreme.
+            typename V::type values;
+            const auto at =
+                index + V::Lanes <= size ? index : size - V::Lanes;
+            V::load(values, data + at);
+            if (std::is_floating_point<Lane>::value) {
+                nans |= values != values;
+            }
+            V::blend(best, Largest ? values > best : values < best, values);
+            if (index + V::Lanes >= size) {
+                break;
+            }
+        }
+        if (V::any(nans)) {
+            return false;
+        }
+
+        Lane lanes[V::Lanes];
+        std::memcpy(lanes, &best, Width);
+        result = lanes[0];
+        for (const auto lane : lanes) {
+            if (Largest ? result < lane : lane < result) {
+                result = lane;
+            }
+        }
+        return true;
+    }
+
+    template <class Lane>
+    static auto sum(const Lane* const data, const size_t size) noexcept
+        -> Lane {
+        using Sum = SumLane<Lane>;
+        using V = Vec<Sum, Width>;
+        constexpr auto Step = 4 * V::Lanes;
+        const auto* const lanes = reinterpret_cast<const Sum*>(data);  // NOLINT
+
+        // Independent accumulators hide the latency of floating point adds.
+        typename V::type sums[4] = {};
+        size_t index = 0;
+        for (; index + Step <= size; index += Step) {
+            for (size_t part = 0; part < 4; ++part) {
+                typename V::type values;
+                V::load(values, lanes + index + part * V::Lanes);
+                sums[part] += values;
+            }
+        }
+        const auto combined = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+
+        Sum values[V::Lanes];
+        std::memcpy(values, &combined, Width);
+        Sum total = 0;
+        for (const auto value : values) {
+            total += value;
+        }
+        for (; index < size; ++index) {
+            total += lanes[index];
+        }
+        return static_cast<Lane>(total);
+    }
+};
+// NOLINTEND(bugprone-macro-parentheses)
@@ -0,0 +1,532 @@
+#ifndef SMALL_ARRAY_LIST_HPP
+#define SMALL_ARRAY_LIST_HPP
+
+#include "array_list.hpp"
+
+namespace al {
+
+/// An ArrayList that keeps its first `InlineCapacity` elements inside the
+/// object, and only allocates once it outgrows them.
+template <typename Type, size_t InlineCapacity,
+          typename Allocator = std::allocator<Type>,
+          typename GrowthPolicy = GeometricGrowth<>>
+AL_REQUIRES(std::is_object<Type>::value)
+class SmallArrayList {
+    static_assert(
+        std::is_same<Type, typename Allocator::value_type>::value,
+        "Requires allocator's type to match the type held by the ArrayList");
+    static_assert(std::is_object<Type>::value,
+                  "Requires type held by the ArrayList to be an object");
+    static_assert(InlineCapacity > 0, "Requires a non-zero inline capacity");
+
+    // NOLINTBEGIN
+    using Alty =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<Type>;
+    using AltyTraits = std::allocator_traits<Alty>;
+
+   public:
+    using value_type = Type;
+    using allocator_type = Alty;
+    using growth_policy_type = GrowthPolicy;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using size_type = typename AltyTraits::size_type;
+    using difference_type = typename AltyTraits::difference_type;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    // NOLINTEND
+
+    static_assert(
+        std::is_same<typename AltyTraits::pointer, pointer>::value,
+        "Requires an allocator handing out raw pointers");
+
+    static constexpr auto inline_capacity() noexcept -> size_type {
+        return InlineCapacity;
+    }
+
+    static constexpr auto max_size() noexcept -> size_type {
+        return static_cast<size_type>(-1) / sizeof(value_type);
+    }
+
+   private:
+    using RelocationTag =
+        typename std::conditional<IsTriviallyRelocatable<Type>::value,
+                                  detail::RelocateByMemcpy,
+                                  detail::RelocateByMove>::type;
+
+    constexpr auto calculate_growth(const size_type new_size) const noexcept
+        -> size_type {
+        return static_cast<size_type>(growth_policy()(
+            capacity(), new_size, max_size(), sizeof(value_type)));
+    }
+
+    AL_NODISCARD constexpr auto get_allocator() noexcept -> allocator_type& {
+        return compressed_.get_first();
+    }
+
+   public:
+    SmallArrayList() noexcept { reset_to_inline(); }
+
+    explicit SmallArrayList(const allocator_type& alloc) noexcept
+        : compressed_(detail::First{}, alloc) {
+        reset_to_inline();
+    }
+
+// NOLINTBEGIN
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    SmallArrayList(Iter first, Iter last,
+                   const allocator_type& alloc = allocator_type(),
+                   typename std::enable_if<detail::IsIteratorV<Iter>,
+                                           std::true_type>::type /* */
+                   = {})
+        : SmallArrayList(alloc) {
+        push_back(first, last);
+    }
+    // NOLINTEND
+
+    SmallArrayList(std::initializer_list<Type> list,
+                   const allocator_type& alloc = allocator_type())
+        : SmallArrayList(list.begin(), list.end(), alloc) {}
+
+    SmallArrayList(const SmallArrayList& other)
+        : SmallArrayList(other.begin(), other.end(),
+                         AltyTraits::select_on_container_copy_construction(
+                             other.compressed_.get_first())) {}
+
+    SmallArrayList(SmallArrayList&& other) noexcept(
+        std::is_nothrow_move_constructible<Type>::value)
+        : compressed_(detail::First{}, std::move(other.get_allocator())) {
+        reset_to_inline();
+        steal(other);
+    }
+
+    auto operator=(const SmallArrayList& other) -> SmallArrayList& {
+        if (this != std::addressof(other)) {
+            copy_allocator(
+                other,
+                typename AltyTraits::propagate_on_container_copy_assignment{});
+            clear();
+            push_back(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    auto operator=(SmallArrayList&& other) noexcept(
+        (AltyTraits::propagate_on_container_move_assignment::value or
+         AltyTraits::is_always_equal::value) and
+        std::is_nothrow_move_constructible<Type>::value) -> SmallArrayList& {
+        if (this != std::addressof(other)) {
+            move_assign(
+                other,
+                typename AltyTraits::propagate_on_container_move_assignment{});
+        }
+        return *this;
+    }
+
+    ~SmallArrayList() {
+        destruct_all_elements();
+        deallocate_heap();
+    }
+
+    AL_NODISCARD auto empty() const noexcept -> bool {
+        auto& p = payload();
+        return p.data == p.current;
+    }
+
+    /// Whether the elements still live in the inline buffer.
+    AL_NODISCARD auto is_inline() const noexcept -> bool {
+        return payload().data == inline_data();
+    }
+
+#if AL_HAS_CONCEPTS
+    template <typename Iter>
+        requires(detail::IsIteratorV<Iter>)
+#else
+    template <typename Iter>
+#endif
+    auto push_back(Iter first, Iter last,
+                   typename std::enable_if<detail::IsIteratorV<Iter>,
+                                           std::true_type>::type /* */
+                   = {}) -> void {
+        push_back_range(first, last, detail::IterConcatenateType<Iter>{});
+    }
+
+    auto push_back(const Type& value) -> void { emplace_back(value); }
+
+    auto push_back(Type&& value) -> void { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> value_type& {
+        auto& p = payload();
+        if (p.current == p.end) {
+            // The argument may alias an element, so build it before growing.
+            value_type tmp(std::forward<Args>(args)...);
+            reserve(calculate_growth(size() + 1));
+            AltyTraits::construct(get_allocator(), p.current, std::move(tmp));
+        } else {
+            AltyTraits::construct(get_allocator(), p.current,
+                                  std::forward<Args>(args)...);
+        }
+        return *p.current++;
+    }
+
+    void pop_back() {
+        ensure_not_empty();
+        auto& p = payload();
+        --p.current;
+        AltyTraits::destroy(get_allocator(), p.current);
+    }
+
+    AL_NODISCARD auto size() const noexcept -> size_type {
+        auto& p = payload();
+        return static_cast<size_type>(p.current - p.data);
+    }
+
+    AL_NODISCARD auto capacity() const noexcept -> size_type {
+        auto& p = payload();
+        return static_cast<size_type>(p.end - p.data);
+    }
+
+    void resize(const size_type new_size) {
+        const auto len = size();
+        auto& p = payload();
+
+        if (new_size < len) {
+            detail::destroy_range<AltyTraits>(p.data + new_size, p.current,
+                                              get_allocator());
+            p.current = p.data + new_size;
+            return;
+        }
+
+        reserve(new_size);
+        std::uninitialized_value_construct_n(p.current, new_size - len);
+        p.current = p.data + new_size;
+    }
+
+    void reserve(const size_type new_capacity) {
+        const auto cap = capacity();
+        if (cap >= new_capacity) {
+            return;
+        }
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+
+        const auto len = size();
+        auto& p = payload();
+
+        if (!is_inline() and detail::try_extend(get_allocator(), p.data, cap,
+                                                new_capacity)) {
+            p.end = p.data + new_capacity;
+            return;
+        }
+
+        const auto new_data =
+            AltyTraits::allocate(get_allocator(), new_capacity);
+        try {
+            detail::relocate_n<AltyTraits>(p.data, len, new_data,
+                                           get_allocator(), RelocationTag{});
+        } catch (...) {
+            AltyTraits::deallocate(get_allocator(), new_data, new_capacity);
+            throw;
+        }
+        deallocate_heap();
+
+        p.data = new_data;
+        p.current = new_data + len;
+        p.end = new_data + new_capacity;
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) noexcept -> reference {
+        return payload().data[index];
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) const noexcept
+        -> const_reference {
+        return payload().data[index];
+    }
+
+    AL_NODISCARD auto at(const size_type index) -> reference {
+        ensure_in_range(index);
+        return payload().data[index];
+    }
+
+    AL_NODISCARD auto at(const size_type index) const -> const_reference {
+        ensure_in_range(index);
+        return payload().data[index];
+    }
+
+    AL_NODISCARD auto data() noexcept -> pointer { return payload().data; }
+
+    AL_NODISCARD auto data() const noexcept -> const_pointer {
+        return payload().data;
+    }
+
+    AL_NODISCARD auto front() -> reference {
+        ensure_not_empty();
+        return *payload().data;
+    }
+
+    AL_NODISCARD auto front() const -> const_reference {
+        ensure_not_empty();
+        return *payload().data;
+    }
+
+    AL_NODISCARD auto back() -> reference {
+        ensure_not_empty();
+        return *(payload().current - 1);
+    }
+
+    AL_NODISCARD auto back() const -> const_reference {
+        ensure_not_empty();
+        return *(payload().current - 1);
+    }
+
+    AL_NODISCARD auto begin() noexcept -> iterator { return payload().data; }
+
+    AL_NODISCARD auto end() noexcept -> iterator { return payload().current; }
+
+    AL_NODISCARD auto begin() const noexcept -> const_iterator {
+        return payload().data;
+    }
+
+    AL_NODISCARD auto end() const noexcept -> const_iterator {
+        return payload().current;
+    }
+
+    AL_NODISCARD auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    AL_NODISCARD auto cend() const noexcept -> const_iterator { return end(); }
+
+    AL_NODISCARD auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    AL_NODISCARD auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    AL_NODISCARD auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    AL_NODISCARD auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    AL_NODISCARD auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    AL_NODISCARD auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    auto clear() noexcept -> void {
+        destruct_all_elements();
+        auto& p = payload();
+        p.current = p.data;
+    }
+
+    auto erase(const_iterator position) -> iterator {
+        return erase(static_cast<size_type>(position - cbegin()));
+    }
+
+    auto erase(const size_type index) -> iterator {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+        auto& p = payload();
+        std::move(p.data + index + 1, p.current, p.data + index);
+        --p.current;
+        AltyTraits::destroy(get_allocator(), p.current);
+        return p.data + index;
+    }
+
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        auto& p = payload();
+        const auto index = first - cbegin();
+        const auto target = p.data + index;
+        if (first != last) {
+            const auto new_end =
+                std::move(p.data + (last - cbegin()), p.current, target);
+            detail::destroy_range<AltyTraits>(new_end, p.current,
+                                              get_allocator());
+            p.current = new_end;
+        }
+        return target;
+    }
+
+    constexpr explicit operator bool() const noexcept { return !empty(); }
+
+    AL_NODISCARD constexpr auto growth_policy() noexcept
+        -> growth_policy_type& {
+        return compressed_.get_second().get_first();
+    }
+
+    AL_NODISCARD constexpr auto growth_policy() const noexcept
+        -> const growth_policy_type& {
+        return compressed_.get_second().get_first();
+    }
+
+   private:
+    friend auto operator==(const SmallArrayList& self,
+                           const SmallArrayList& that) noexcept -> bool {
+        if (self.size() != that.size()) {
+            return false;
+        }
+        return std::equal(self.begin(), self.end(), that.begin());
+    }
+
+    friend auto operator!=(const SmallArrayList& self,
+                           const SmallArrayList& that) noexcept -> bool {
+        return !(self == that);
+    }
+
+    template <class Iter>
+    auto push_back_range(Iter first, Iter last, std::input_iterator_tag)
+        -> void {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    template <class Iter>
+    auto push_back_range(Iter first, Iter last, std::forward_iterator_tag)
+        -> void {
+        const auto length = static_cast<size_type>(std::distance(first, last));
+        if (size() + length > capacity()) {
+            reserve(calculate_growth(size() + length));
+        }
+        auto& p = payload();
+        p.current = std::uninitialized_copy(first, last, p.current);
+    }
+
+    void steal(SmallArrayList& other) noexcept(
+        std::is_nothrow_move_constructible<Type>::value) {
+        auto& p = payload();
+        auto& o = other.payload();
+        if (other.is_inline()) {
+            const auto len = other.size();
+            detail::relocate_n<AltyTraits>(o.data, len, p.data,
+                                           other.get_allocator(),
+                                           RelocationTag{});
+            p.current = p.data + len;
+            o.current = o.data;
+        } else {
+            p = o;
+            other.reset_to_inline();
+        }
+    }
+
+    void copy_allocator(const SmallArrayList& other, std::true_type) {
+        if (get_allocator() != other.compressed_.get_first()) {
+            // The buffer has to go back to the allocator that made it.
+            clear();
+            deallocate_heap();
+            reset_to_inline();
+        }
+        get_allocator() = other.compressed_.get_first();
+    }
+
+    void copy_allocator(const SmallArrayList& /* other */,
+                        std::false_type) noexcept {}
+
+    void move_assign(SmallArrayList& other, std::true_type) noexcept(
+        std::is_nothrow_move_constructible<Type>::value) {
+        clear();
+        deallocate_heap();
+        reset_to_inline();
+        steal(other);
+        get_allocator() = std::move(other.get_allocator());
+    }
+
+    void move_assign(SmallArrayList& other, std::false_type) {
+        if (get_allocator() == other.get_allocator()) {
+            clear();
+            deallocate_heap();
+            reset_to_inline();
+            steal(other);
+            return;
+        }
+
+        // Memory from another allocator can't be adopted, move the elements.
+        clear();
+        push_back(std::make_move_iterator(other.begin()),
+                  std::make_move_iterator(other.end()));
+        other.clear();
+    }
+
+    void ensure_in_range(const size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    void ensure_not_empty() const {
+        if (empty()) {
+            throw std::out_of_range("ArrayList is empty");
+        }
+    }
+
+    auto destruct_all_elements() noexcept -> void {
+        detail::destruct_all_elements<AltyTraits>(begin(), end(),
+                                                  get_allocator());
+    }
+
+    auto deallocate_heap() -> void {
+        if (!is_inline()) {
+            AltyTraits::deallocate(get_allocator(), payload().data, capacity());
+        }
+    }
+
+    auto inline_data() noexcept -> pointer {
+        return reinterpret_cast<pointer>(inline_storage_);  // NOLINT
+    }
+
+    auto inline_data() const noexcept -> const_pointer {
+        return reinterpret_cast<const_pointer>(inline_storage_);  // NOLINT
+    }
+
+    auto reset_to_inline() noexcept -> void {
+        auto& p = payload();
+        p.data = inline_data();
+        p.current = p.data;
+        p.end = p.data + InlineCapacity;
+    }
+
+    struct Payload {
+        pointer data = nullptr;
+        pointer end = nullptr;
+        pointer current = nullptr;
+    };
+
+    constexpr auto payload() noexcept -> Payload& {
+        return compressed_.get_second().get_second();
+    }
+
+    constexpr auto payload() const noexcept -> const Payload& {
+        return compressed_.get_second().get_second();
+    }
+
+    using Compressed = detail::CompressedPair<
+        allocator_type, detail::CompressedPair<growth_policy_type, Payload>>;
+
+    Compressed compressed_;
+    alignas(Type) unsigned char inline_storage_[InlineCapacity * sizeof(Type)];
+};
+
+}  // namespace al
+
+#endif  // SMALL_ARRAY_LIST_HPP
@@ -0,0 +1,795 @@
+#ifndef SOA_ARRAY_LIST_HPP
+#define SOA_ARRAY_LIST_HPP
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+#include "array_list.hpp"
+
+namespace al {
+
+/// A view of one column: a pointer and a size, usable wherever a contiguous
+/// range is (including `std::span`).
+template <class Type>
+class Column {
+   public:
+    using value_type = typename std::remove_const<Type>::type;
+    using pointer = Type*;
+    using reference = Type&;
+    using iterator = Type*;
+    using size_type = size_t;
+
+    constexpr Column() noexcept = default;
+
+    constexpr Column(Type* const data, const size_type size) noexcept
+        : data_(data), size_(size) {}
+
+    AL_NODISCARD constexpr auto data() const noexcept -> pointer {
+        return data_;
+    }
+
+    AL_NODISCARD constexpr auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    AL_NODISCARD constexpr auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    AL_NODISCARD constexpr auto begin() const noexcept -> iterator {
+        return data_;
+    }
+
+    AL_NODISCARD constexpr auto end() const noexcept -> iterator {
+        return data_ + size_;
+    }
+
+    AL_NODISCARD constexpr auto operator[](const size_type index) const noexcept
+        -> reference {
+        return data_[index];
+    }
+
+   private:
+    Type* data_ = nullptr;
+    size_type size_ = 0;
+};
+
+/// One row of a SoAArrayList, standing in for a reference to a struct.
+/// `get<Index>()` is a reference to that field, which also makes rows work
+/// with structured bindings.
+template <class List>
+class SoARow {
+    using Values = typename std::remove_const<List>::type::value_type;
+
+   public:
+    SoARow(List& list, const size_t index) noexcept
+        : list_(&list), index_(index) {}
+
+    SoARow(const SoARow&) noexcept = default;
+
+    template <size_t Index>
+    AL_NODISCARD auto get() const noexcept
+        -> decltype(std::declval<List&>().template column<Index>()[0]) {
+        return list_->template column<Index>()[index_];
+    }
+
+    AL_NODISCARD auto index() const noexcept -> size_t { return index_; }
+
+    /// Copies the fields out.
+    AL_NODISCARD auto values() const -> Values {
+        return values(
+            std::make_index_sequence<std::tuple_size<Values>::value>{});
+    }
+
+    /// Assigns every field from `values`.
+    template <class Tuple>
+    auto operator=(const Tuple& values) const -> const SoARow& {
+        assign(values,
+               std::make_index_sequence<std::tuple_size<Values>::value>{});
+        return *this;
+    }
+
+    /// Assigns every field from another row. Like assigning through a
+    /// reference, this row keeps referring to the same place.
+    auto operator=(const SoARow& other) const -> const SoARow& {
+        return *this = other.values();
+    }
+
+    template <class Other>
+    auto operator=(const SoARow<Other>& other) const -> const SoARow& {
+        return *this = other.values();
+    }
+
+   private:
+    template <size_t... Indices>
+    auto values(std::index_sequence<Indices...> /* fields */) const -> Values {
+        return Values(get<Indices>()...);
+    }
+
+    template <class Tuple, size_t... Indices>
+    void assign(const Tuple& values,
+                std::index_sequence<Indices...> /* fields */) const {
+        (void(get<Indices>() = std::get<Indices>(values)), ...);
+    }
+
+    List* list_;
+    size_t index_;
+};
+
+/// Walks the rows of a SoAArrayList in order.
+template <class List>
+class SoARowIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<List>::type::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = SoARow<List>;
+    using pointer = void;
+
+    SoARowIterator() noexcept = default;
+
+    SoARowIterator(List& list, const size_t index) noexcept
+        : list_(&list), index_(index) {}
+
+    AL_NODISCARD auto operator*() const noexcept -> reference {
+        return SoARow<List>(*list_, index_);
+    }
+
+    auto operator++() noexcept -> SoARowIterator& {
+        ++index_;
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> SoARowIterator {
+        auto copy = *this;
+        ++index_;
+        return copy;
+    }
+
+    AL_NODISCARD friend auto operator==(const SoARowIterator& self,
+                                        const SoARowIterator& that) noexcept
+        -> bool {
+        return self.index_ == that.index_;
+    }
+
+    AL_NODISCARD friend auto operator!=(const SoARowIterator& self,
+                                        const SoARowIterator& that) noexcept
+        -> bool {
+        return self.index_ != that.index_;
+    }
+
+   private:
+    List* list_ = nullptr;
+    size_t index_ = 0;
+};
+
+namespace detail {
+
+/// Columns start on their own cache line, so each is aligned for any
+/// vector width up to AVX-512.
+constexpr size_t ColumnAlignment = 64;
+
+struct alignas(ColumnAlignment) ColumnLine {
+    unsigned char bytes[ColumnAlignment];
+};
+
+}  // namespace detail
+
+/// A list of rows stored as one contiguous column per field, so a loop over
+/// a few fields only pulls those fields into cache. All columns share one
+/// size, one capacity and a single allocation, and every operation keeps
+/// them in step.
+///
+/// Fields must move without throwing, so growing and erasing cannot leave
+/// the columns out of step.
+template <class Allocator, class GrowthPolicy, typename... Types>
+class BasicSoAArrayList {
+    static_assert(sizeof...(Types) > 0, "Requires at least one field");
+    static_assert(
+        std::conjunction<std::is_nothrow_move_constructible<Types>...,
+                         std::is_nothrow_move_assignable<Types>...>::value,
+        "Requires fields that can be moved without throwing");
+    static_assert(
+        std::conjunction<std::bool_constant<alignof(Types) <=
+                                            detail::ColumnAlignment>...>::value,
+        "Requires fields aligned to at most a cache line");
+
+    // NOLINTBEGIN
+    using Alty = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<detail::ColumnLine>;
+    using AltyTraits = std::allocator_traits<Alty>;
+    // NOLINTEND
+
+    static constexpr size_t FieldCount = sizeof...(Types);
+
+    template <size_t Index>
+    using Field =
+        typename std::tuple_element<Index, std::tuple<Types...>>::type;
+
+    using Offsets = std::array<size_t, FieldCount + 1>;
+    using Columns = std::tuple<Types*...>;
+
+   public:
+    // NOLINTBEGIN
+    using value_type = std::tuple<Types...>;
+    using allocator_type = Alty;
+    using size_type = size_t;
+    using row = SoARow<BasicSoAArrayList>;
+    using const_row = SoARow<const BasicSoAArrayList>;
+    using iterator = SoARowIterator<BasicSoAArrayList>;
+    using const_iterator = SoARowIterator<const BasicSoAArrayList>;
+    // NOLINTEND
+
+    BasicSoAArrayList() noexcept = default;
+
+    explicit BasicSoAArrayList(const allocator_type& alloc) noexcept
+        : allocator_(alloc) {}
+
+    BasicSoAArrayList(const BasicSoAArrayList& other)
+        : allocator_(AltyTraits::select_on_container_copy_construction(
+              other.allocator_)) {
+        copy_from(other);
+    }
+
+    BasicSoAArrayList(BasicSoAArrayList&& other) noexcept
+        : allocator_(std::move(other.allocator_)) {
+        steal(other);
+    }
+
+    auto operator=(const BasicSoAArrayList& other) -> BasicSoAArrayList& {
+        if (this != std::addressof(other)) {
+            BasicSoAArrayList copy(
+                other,
+                AltyTraits::propagate_on_container_copy_assignment::value
+                    ? other.allocator_
+                    : allocator_);
+            // The old block leaves with the allocator that made it.
+            swap_allocator(copy, std::true_type{});
+            swap_storage(copy);
+        }
+        return *this;
+    }
+
+    auto operator=(BasicSoAArrayList&& other) noexcept(
+        AltyTraits::propagate_on_container_move_assignment::value or
+        AltyTraits::is_always_equal::value) -> BasicSoAArrayList& {
+        if (this != std::addressof(other)) {
+            move_assign(
+                other,
+                typename AltyTraits::propagate_on_container_move_assignment{});
+        }
+        return *this;
+    }
+
+    ~BasicSoAArrayList() {
+        clear();
+        deallocate();
+    }
+
+    AL_NODISCARD auto size() const noexcept -> size_type { return size_; }
+
+    AL_NODISCARD auto empty() const noexcept -> bool { return size_ == 0; }
+
+    AL_NODISCARD auto capacity() const noexcept -> size_type {
+        return capacity_;
+    }
+
+    static constexpr auto max_size() noexcept -> size_type {
+        return static_cast<size_type>(-1) /
+               (RowBytes + FieldCount * detail::ColumnAlignment) / 2;
+    }
+
+    AL_NODISCARD auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    /// The field `Index` of every row, contiguous and aligned to a cache
+    /// line.
+    template <size_t Index>
+    AL_NODISCARD auto column() noexcept -> Column<Field<Index>> {
+        return Column<Field<Index>>(std::get<Index>(columns_), size_);
+    }
+
+    template <size_t Index>
+    AL_NODISCARD auto column() const noexcept -> Column<const Field<Index>> {
+        return Column<const Field<Index>>(std::get<Index>(columns_), size_);
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) noexcept -> row {
+        return row(*this, index);
+    }
+
+    AL_NODISCARD auto operator[](const size_type index) const noexcept
+        -> const_row {
+        return const_row(*this, index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) -> row {
+        ensure_in_range(index);
+        return row(*this, index);
+    }
+
+    AL_NODISCARD auto at(const size_type index) const -> const_row {
+        ensure_in_range(index);
+        return const_row(*this, index);
+    }
+
+    AL_NODISCARD auto front() -> row {
+        ensure_not_empty();
+        return row(*this, 0);
+    }
+
+    AL_NODISCARD auto front() const -> const_row {
+        ensure_not_empty();
+        return const_row(*this, 0);
+    }
+
+    AL_NODISCARD auto back() -> row {
+        ensure_not_empty();
+        return row(*this, size_ - 1);
+    }
+
+    AL_NODISCARD auto back() const -> const_row {
+        ensure_not_empty();
+        return const_row(*this, size_ - 1);
+    }
+
+    AL_NODISCARD auto begin() noexcept -> iterator {
+        return iterator(*this, 0);
+    }
+
+    AL_NODISCARD auto end() noexcept -> iterator {
+        return iterator(*this, size_);
+    }
+
+    AL_NODISCARD auto begin() const noexcept -> const_iterator {
+        return const_iterator(*this, 0);
+    }
+
+    AL_NODISCARD auto end() const noexcept -> const_iterator {
+        return const_iterator(*this, size_);
+    }
+
+    /// Appends a row built from one argument per field.
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> row {
+        static_assert(sizeof...(Args) == FieldCount,
+                      "Requires one argument per field");
+        if (size_ == capacity_) {
+            // Built in the new block before the rows move, so arguments
+            // naming fields of this list stay valid.
+            reallocate(grow_to(1), [&](const Columns& columns) {
+                construct_row(columns, std::index_sequence_for<Types...>{},
+                              std::forward<Args>(args)...);
+            });
+        } else {
+            construct_row(columns_, std::index_sequence_for<Types...>{},
+                          std::forward<Args>(args)...);
+        }
+        ++size_;
+        return back();
+    }
+
+    auto push_back(const value_type& values) -> row {
+        return push_tuple(values, std::index_sequence_for<Types...>{});
+    }
+
+    auto push_back(value_type&& values) -> row {
+        return push_tuple(std::move(values),
+                          std::index_sequence_for<Types...>{});
+    }
+
+    void pop_back() {
+        ensure_not_empty();
+        --size_;
+        for_each_column([this](auto* data) { destroy(data + size_, 1); });
+    }
+
+    /// Resizes every column, value-initializing new rows.
+    void resize(const size_type count) {
+        if (count <= size_) {
+            truncate(count);
+            return;
+        }
+        reserve_for(count - size_);
+        fill_rows(count, std::index_sequence_for<Types...>{});
+        size_ = count;
+    }
+
+    void reserve(const size_type new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (size_ < capacity_) {
+            reallocate(size_);
+        }
+    }
+
+    void clear() noexcept { truncate(0); }
+
+    /// Removes row `index`, shifting the rows after it down.
+    void erase(const size_type index) {
+        ensure_in_range(index);
+        erase(index, index + 1);
+    }
+
+    /// Removes rows [first, last), shifting the rows after them down.
+    void erase(const size_type first, const size_type last) {
+        if (first > last or last > size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (first == last) {
+            return;
+        }
+        for_each_column([this, first, last](auto* data) {
+            std::move(data + last, data + size_, data + first);
+        });
+        truncate(size_ - (last - first));
+    }
+
+    /// Removes row `index` by moving the last row into its place, which is
+    /// constant time but does not keep the order.
+    void swap_remove(const size_type index) {
+        ensure_in_range(index);
+        const auto last = size_ - 1;
+        if (index != last) {
+            for_each_column([index, last](auto* data) {
+                data[index] = std::move(data[last]);
+            });
+        }
+        pop_back();
+    }
+
+    void swap(BasicSoAArrayList& other) noexcept {
+        swap_allocator(other,
+                       typename AltyTraits::propagate_on_container_swap{});
+        swap_storage(other);
+    }
+
+    friend void swap(BasicSoAArrayList& self,
+                     BasicSoAArrayList& that) noexcept {
+        self.swap(that);
+    }
+
+   private:
+    static constexpr size_t RowBytes = (sizeof(Types) + ...);
+
+    /// Constructs a copy of `other` using `alloc`.
+    BasicSoAArrayList(const BasicSoAArrayList& other,
+                      const allocator_type& alloc)
+        : allocator_(alloc) {
+        copy_from(other);
+    }
+
+    /// Copies `other` into this list under construction, which no
+    /// destructor will clean up if a copy throws.
+    void copy_from(const BasicSoAArrayList& other) {
+        try {
+            append_columns(other, std::index_sequence_for<Types...>{});
+        } catch (...) {
+            deallocate();
+            throw;
+        }
+    }
+
+    static constexpr auto round_up(const size_t bytes) noexcept -> size_t {
+        return (bytes + detail::ColumnAlignment - 1) /
+               detail::ColumnAlignment * detail::ColumnAlignment;
+    }
+
+    /// Where each column starts in a block holding `capacity` rows, and the
+    /// size of the block last.
+    static auto layout(const size_type capacity) noexcept -> Offsets {
+        constexpr size_t Sizes[] = {sizeof(Types)...};
+        Offsets offsets{};
+        for (size_t field = 0; field < FieldCount; ++field) {
+            offsets[field + 1] =
+                round_up(offsets[field] + capacity * Sizes[field]);
+        }
+        return offsets;
+    }
+
+    template <class Function>
+    void for_each_column(Function function) const {
+        std::apply([&function](auto*... data) { (function(data), ...); },
+                   columns_);
+    }
+
+    template <class Type>
+    static void destroy(Type* const data, const size_type count) noexcept {
+        if (not std::is_trivially_destructible<Type>::value) {
+            for (size_type i = 0; i < count; ++i) {
+                data[i].~Type();
+            }
+        }
+    }
+
+    void truncate(const size_type count) noexcept {
+        for_each_column([this, count](auto* data) {
+            destroy(data + count, size_ - count);
+        });
+        size_ = count;
+    }
+
+    /// The capacity to grow to for `extra` more rows.
+    auto grow_to(const size_type extra) const -> size_type {
+        if (extra > max_size() - size_) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        return static_cast<size_type>(
+            growth_policy_(capacity_, size_ + extra, max_size(), RowBytes));
+    }
+
+    void reserve_for(const size_type extra) {
+        if (extra > capacity_ - size_) {
+            reallocate(grow_to(extra));
+        }
+    }
+
+    void reallocate(const size_type new_capacity) {
+        reallocate(new_capacity, [](const Columns& /* columns */) {});
+    }
+
+    /// Moves every row into a new block for `new_capacity` rows, after
+    /// `prepare(columns)` has had a chance to build more rows there.
+    template <class Prepare>
+    void reallocate(const size_type new_capacity, Prepare prepare) {
+        if (new_capacity > max_size()) {
+            throw std::length_error("ArrayList capacity exceeds max_size");
+        }
+        const auto offsets = layout(new_capacity);
+        const auto lines = offsets.back() / detail::ColumnAlignment;
+        auto* const block =
+            lines == 0 ? nullptr : AltyTraits::allocate(allocator_, lines);
+        const auto columns =
+            columns_in(block, offsets, std::index_sequence_for<Types...>{});
+        try {
+            prepare(columns);
+        } catch (...) {
+            AltyTraits::deallocate(allocator_, block, lines);
+            throw;
+        }
+
+        relocate_columns(columns, std::index_sequence_for<Types...>{});
+        deallocate();
+        block_ = block;
+        columns_ = columns;
+        capacity_ = new_capacity;
+    }
+
+    template <size_t... Indices>
+    static auto columns_in(detail::ColumnLine* const block,
+                           const Offsets& offsets,
+                           std::index_sequence<Indices...> /* fields */)
+        -> Columns {
+        if (block == nullptr) {
+            return Columns{};
+        }
+        auto* const bytes = reinterpret_cast<unsigned char*>(block);
+        return Columns(
+            reinterpret_cast<Field<Indices>*>(bytes + offsets[Indices])...);
+    }
+
+    template <size_t... Indices>
+    void relocate_columns(
+        const Columns& columns,
+        std::index_sequence<Indices...> /* fields */) noexcept {
+        (relocate(std::get<Indices>(columns_), std::get<Indices>(columns)),
+         ...);
+    }
+
+    template <class Type>
+    void relocate(Type* const from, Type* const to) noexcept {
+        if (size_ == 0) {
+            return;
+        }
+        if (IsTriviallyRelocatable<Type>::value) {
+            std::memcpy(static_cast<void*>(to), from, size_ * sizeof(Type));
+            return;
+        }
+        for (size_type i = 0; i < size_; ++i) {
+            ::new (static_cast<void*>(to + i)) Type(std::move(from[i]));
+            from[i].~Type();
+        }
+    }
+
+    void deallocate() noexcept {
+        if (block_ != nullptr) {
+            AltyTraits::deallocate(
+                allocator_, block_,
+                layout(capacity_).back() / detail::ColumnAlignment);
+        }
+        block_ = nullptr;
+        capacity_ = 0;
+        columns_ = Columns{};
+    }
+
+    /// Constructs field `Index` of row `size_` in `columns` from `arg`, then
+    /// the fields after it. If one throws, the fields already built in this
+    /// row are destroyed again.
+    template <size_t Index, size_t... Rest, class Arg, class... Args>
+    void construct_fields(const Columns& columns, Arg&& arg, Args&&... args) {
+        auto* const slot = std::get<Index>(columns) + size_;
+        ::new (static_cast<void*>(slot)) Field<Index>(std::forward<Arg>(arg));
+        if constexpr (sizeof...(Rest) > 0) {
+            try {
+                construct_fields<Rest...>(columns, std::forward<Args>(args)...);
+            } catch (...) {
+                destroy(slot, 1);
+                throw;
+            }
+        }
+    }
+
+    template <size_t... Indices, class... Args>
+    void construct_row(const Columns& columns,
+                       std::index_sequence<Indices...> /* fields */,
+                       Args&&... args) {
+        construct_fields<Indices...>(columns, std::forward<Args>(args)...);
+    }
+
+    template <class Tuple, size_t... Indices>
+    auto push_tuple(Tuple&& values, std::index_sequence<Indices...> /* */)
+        -> row {
+        return emplace_back(std::get<Indices>(std::forward<Tuple>(values))...);
+    }
+
+    /// Value-initializes rows [size_, count) column by column. If a field
+    /// throws, everything built so far is destroyed again.
+    template <size_t... Indices>
+    void fill_rows(const size_type count,
+                   std::index_sequence<Indices...> /* fields */) {
+        size_t filled = 0;
+        try {
+            (fill_column(std::get<Indices>(columns_), count, filled), ...);
+        } catch (...) {
+            size_t field = 0;
+            (void(field++ < filled
+                      ? destroy(std::get<Indices>(columns_) + size_,
+                                count - size_)
+                      : void()),
+             ...);
+            throw;
+        }
+    }
+
+    template <class Type>
+    void fill_column(Type* const data, const size_type count, size_t& filled) {
+        auto index = size_;
+        try {
+            for (; index < count; ++index) {
+                ::new (static_cast<void*>(data + index)) Type();
+            }
+        } catch (...) {
+            destroy(data + size_, index - size_);
+            throw;
+        }
+        ++filled;
+    }
+
+    /// Copies every row of `other` onto the end, column by column, or moves
+    /// them when `other` is an rvalue.
+    template <class Other, size_t... Indices>
+    void append_columns(Other&& other,
+                        std::index_sequence<Indices...> /* fields */) {
+        reserve_for(other.size_);
+        size_t copied = 0;
+        try {
+            (copy_column<std::is_rvalue_reference<Other&&>::value>(
+                 std::get<Indices>(other.columns_), std::get<Indices>(columns_),
+                 other.size_, copied),
+             ...);
+        } catch (...) {
+            size_t field = 0;
+            (void(field++ < copied
+                      ? destroy(std::get<Indices>(columns_) + size_,
+                                other.size_)
+                      : void()),
+             ...);
+            throw;
+        }
+        size_ += other.size_;
+    }
+
+    template <bool Move, class Type>
+    void copy_column(Type* const from, Type* const to, const size_type count,
+                     size_t& copied) {
+        if constexpr (Move) {
+            std::uninitialized_move_n(from, count, to + size_);
+        } else {
+            std::uninitialized_copy_n(static_cast<const Type*>(from), count,
+                                      to + size_);
+        }
+        ++copied;
+    }
+
+    void steal(BasicSoAArrayList& other) noexcept {
+        block_ = std::exchange(other.block_, nullptr);
+        columns_ = std::exchange(other.columns_, Columns{});
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+
+    void swap_storage(BasicSoAArrayList& other) noexcept {
+        using std::swap;
+        swap(block_, other.block_);
+        swap(columns_, other.columns_);
+        swap(size_, other.size_);
+        swap(capacity_, other.capacity_);
+    }
+
+    void move_assign(BasicSoAArrayList& other, std::true_type) noexcept {
+        clear();
+        deallocate();
+        allocator_ = std::move(other.allocator_);
+        steal(other);
+    }
+
+    void move_assign(BasicSoAArrayList& other, std::false_type) {
+        if (allocator_ == other.allocator_) {
+            clear();
+            deallocate();
+            steal(other);
+            return;
+        }
+        // The other block cannot be handed over, so the rows move one by one.
+        clear();
+        append_columns(std::move(other), std::index_sequence_for<Types...>{});
+        other.clear();
+    }
+
+    void swap_allocator(BasicSoAArrayList& other, std::true_type) noexcept {
+        using std::swap;
+        swap(allocator_, other.allocator_);
+    }
+
+    void swap_allocator(BasicSoAArrayList& /* other */,
+                        std::false_type) noexcept {}
+
+    void ensure_in_range(const size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    void ensure_not_empty() const {
+        if (size_ == 0) {
+            throw std::out_of_range("ArrayList is empty");
+        }
+    }
+
+    Alty allocator_;
+    GrowthPolicy growth_policy_;
+    detail::ColumnLine* block_ = nullptr;
+    Columns columns_;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+/// A struct-of-arrays list with one column per type in `Types`.
+template <typename... Types>
+using SoAArrayList =
+    BasicSoAArrayList<std::allocator<detail::ColumnLine>, GeometricGrowth<>,
+                      Types...>;
+
+}  // namespace al
+
+namespace std {
+
+template <class List>
+struct tuple_size<al::SoARow<List>>
+    : tuple_size<typename remove_const<List>::type::value_type> {};
+
+template <size_t Index, class List>
+struct tuple_element<Index, al::SoARow<List>> {
+    using type =
+        decltype(declval<const al::SoARow<List>&>().template get<Index>());
+};
+
+}  // namespace std
+
+#endif  // SOA_ARRAY_LIST_HPP
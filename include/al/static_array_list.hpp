@@ -0,0 +1,408 @@
+#ifndef STATIC_ARRAY_LIST_HPP
+#define STATIC_ARRAY_LIST_HPP
+
+#include <cstdint>
+#include <limits>
+
+#include "array_list.hpp"
+
+namespace al {
+
+namespace detail {
+
+/// The smallest unsigned integer type that can count up to `Count`.
+template <size_t Count>
+using SmallestSizeType = typename std::conditional<
+    Count <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+    typename std::conditional<
+        Count <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+        typename std::conditional<
+            Count <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t,
+            std::uint64_t>::type>::type>::type;
+
+/// Storage for trivial types is a plain array, which keeps the list a literal
+/// type and usable during constant evaluation.
+template <class Type, size_t Capacity, bool = std::is_trivial<Type>::value>
+struct StaticStorage {
+    using SizeType = SmallestSizeType<Capacity>;
+
+    template <class... Args>
+    constexpr void construct(const SizeType index, Args&&... args) {
+        elements[index] = Type(std::forward<Args>(args)...);
+    }
+
+    constexpr void destroy(const SizeType /* index */) noexcept {}
+
+    constexpr auto ptr() noexcept -> Type* { return elements; }
+    constexpr auto ptr() const noexcept -> const Type* { return elements; }
+
+    Type elements[Capacity]{};
+    SizeType size = 0;
+};
+
+template <class Type, size_t Capacity>
+struct StaticStorage<Type, Capacity, false> {
+    using SizeType = SmallestSizeType<Capacity>;
+
+    StaticStorage() noexcept {}  // NOLINT
+
+    // A throwing element leaves the object unconstructed, so its destructor
+    // never runs; the elements built so far are destroyed here instead.
+    StaticStorage(const StaticStorage& other) {
+        try {
+            for (; size < other.size; ++size) {
+                construct(size, other.ptr()[size]);
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    StaticStorage(StaticStorage&& other) noexcept(
+        std::is_nothrow_move_constructible<Type>::value) {
+        try {
+            for (; size < other.size; ++size) {
+                construct(size, std::move(other.ptr()[size]));
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    auto operator=(const StaticStorage& other) -> StaticStorage& {
+        if (this != std::addressof(other)) {
+            clear();
+            for (; size < other.size; ++size) {
+                construct(size, other.ptr()[size]);
+            }
+        }
+        return *this;
+    }
+
+    auto operator=(StaticStorage&& other) noexcept(
+        std::is_nothrow_move_constructible<Type>::value) -> StaticStorage& {
+        if (this != std::addressof(other)) {
+            clear();
+            for (; size < other.size; ++size) {
+                construct(size, std::move(other.ptr()[size]));
+            }
+        }
+        return *this;
+    }
+
+    ~StaticStorage() { clear(); }
+
+    template <class... Args>
+    void construct(const SizeType index, Args&&... args) {
+        ::new (static_cast<void*>(ptr() + index))
+            Type(std::forward<Args>(args)...);
+    }
+
+    void destroy(const SizeType index) noexcept { ptr()[index].~Type(); }
+
+    void clear() noexcept {
+        for (; size > 0; --size) {
+            destroy(static_cast<SizeType>(size - 1));
+        }
+    }
+
+    auto ptr() noexcept -> Type* {
+        return reinterpret_cast<Type*>(bytes);  // NOLINT
+    }
+
+    auto ptr() const noexcept -> const Type* {
+        return reinterpret_cast<const Type*>(bytes);  // NOLINT
+    }
+
+    alignas(Type) unsigned char bytes[Capacity * sizeof(Type)];
+    SizeType size = 0;
+};
+
+}  // namespace detail
+
+/// An ArrayList with a fixed capacity held entirely inside the object. It
+/// never allocates; the `try_` functions report a full list instead of
+/// throwing. Trivial element types can be used in constant expressions.
+/// The size is stored in the smallest type that fits `Capacity`, while
+/// indices and sizes are taken and returned as `size_t`.
+template <typename Type, size_t Capacity>
+AL_REQUIRES(std::is_object<Type>::value)
+class StaticArrayList {
+    static_assert(std::is_object<Type>::value,
+                  "Requires type held by the ArrayList to be an object");
+    static_assert(Capacity > 0, "Requires a non-zero capacity");
+
+    using Storage = detail::StaticStorage<Type, Capacity>;
+
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using pointer = Type*;
+    using const_pointer = const Type*;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    // NOLINTEND
+
+    static constexpr auto max_size() noexcept -> size_type { return Capacity; }
+
+    static constexpr auto capacity() noexcept -> size_type {
+        return max_size();
+    }
+
+    constexpr StaticArrayList() noexcept = default;
+
+    constexpr StaticArrayList(std::initializer_list<Type> list) {
+        if (list.size() > Capacity) {
+            throw std::length_error("StaticArrayList capacity exceeded");
+        }
+        for (const auto& value : list) {
+            raw_emplace_back(value);
+        }
+    }
+
+    AL_NODISCARD constexpr auto empty() const noexcept -> bool {
+        return storage_.size == 0;
+    }
+
+    AL_NODISCARD constexpr auto full() const noexcept -> bool {
+        return storage_.size == Capacity;
+    }
+
+    AL_NODISCARD constexpr auto size() const noexcept -> size_type {
+        return storage_.size;
+    }
+
+    constexpr auto push_back(const Type& value) -> void { emplace_back(value); }
+
+    constexpr auto push_back(Type&& value) -> void {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> value_type& {
+        if (full()) {
+            throw std::length_error("StaticArrayList capacity exceeded");
+        }
+        return raw_emplace_back(std::forward<Args>(args)...);
+    }
+
+    AL_NODISCARD constexpr auto try_push_back(const Type& value) -> bool {
+        return try_emplace_back(value) != nullptr;
+    }
+
+    AL_NODISCARD constexpr auto try_push_back(Type&& value) -> bool {
+        return try_emplace_back(std::move(value)) != nullptr;
+    }
+
+    /// Returns the new element, or `nullptr` when the list is full.
+    template <typename... Args>
+    AL_NODISCARD constexpr auto try_emplace_back(Args&&... args) -> pointer {
+        if (full()) {
+            return nullptr;
+        }
+        return std::addressof(raw_emplace_back(std::forward<Args>(args)...));
+    }
+
+    constexpr void pop_back() {
+        ensure_not_empty();
+        --storage_.size;
+        storage_.destroy(storage_.size);
+    }
+
+    constexpr void resize(const size_type new_size) {
+        if (new_size > Capacity) {
+            throw std::length_error("StaticArrayList capacity exceeded");
+        }
+        while (storage_.size > new_size) {
+            pop_back();
+        }
+        while (storage_.size < new_size) {
+            raw_emplace_back();
+        }
+    }
+
+    AL_NODISCARD constexpr auto operator[](const size_type index) noexcept
+        -> reference {
+        return storage_.ptr()[index];
+    }
+
+    AL_NODISCARD constexpr auto operator[](const size_type index) const noexcept
+        -> const_reference {
+        return storage_.ptr()[index];
+    }
+
+    AL_NODISCARD constexpr auto at(const size_type index) -> reference {
+        ensure_in_range(index);
+        return storage_.ptr()[index];
+    }
+
+    AL_NODISCARD constexpr auto at(const size_type index) const
+        -> const_reference {
+        ensure_in_range(index);
+        return storage_.ptr()[index];
+    }
+
+    AL_NODISCARD constexpr auto data() noexcept -> pointer {
+        return storage_.ptr();
+    }
+
+    AL_NODISCARD constexpr auto data() const noexcept -> const_pointer {
+        return storage_.ptr();
+    }
+
+    AL_NODISCARD constexpr auto front() -> reference {
+        ensure_not_empty();
+        return *begin();
+    }
+
+    AL_NODISCARD constexpr auto front() const -> const_reference {
+        ensure_not_empty();
+        return *begin();
+    }
+
+    AL_NODISCARD constexpr auto back() -> reference {
+        ensure_not_empty();
+        return *(end() - 1);
+    }
+
+    AL_NODISCARD constexpr auto back() const -> const_reference {
+        ensure_not_empty();
+        return *(end() - 1);
+    }
+
+    AL_NODISCARD constexpr auto begin() noexcept -> iterator {
+        return storage_.ptr();
+    }
+
+    AL_NODISCARD constexpr auto end() noexcept -> iterator {
+        return storage_.ptr() + storage_.size;
+    }
+
+    AL_NODISCARD constexpr auto begin() const noexcept -> const_iterator {
+        return storage_.ptr();
+    }
+
+    AL_NODISCARD constexpr auto end() const noexcept -> const_iterator {
+        return storage_.ptr() + storage_.size;
+    }
+
+    AL_NODISCARD constexpr auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    AL_NODISCARD constexpr auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    AL_NODISCARD constexpr auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    AL_NODISCARD constexpr auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    AL_NODISCARD constexpr auto rbegin() const noexcept
+        -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    AL_NODISCARD constexpr auto rend() const noexcept
+        -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    AL_NODISCARD constexpr auto crbegin() const noexcept
+        -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    AL_NODISCARD constexpr auto crend() const noexcept
+        -> const_reverse_iterator {
+        return rend();
+    }
+
+    constexpr auto clear() noexcept -> void {
+        while (storage_.size > 0) {
+            --storage_.size;
+            storage_.destroy(storage_.size);
+        }
+    }
+
+    constexpr auto erase(const_iterator position) -> iterator {
+        ensure_in_range(static_cast<size_type>(position - cbegin()));
+        return erase(position, position + 1);
+    }
+
+    constexpr auto erase(const_iterator first, const_iterator last)
+        -> iterator {
+        if (first < cbegin() or first > last or last > cend()) {
+            throw std::out_of_range("Index out of range");
+        }
+        const auto target = begin() + (first - cbegin());
+        if (first != last) {
+            auto new_end =
+                std::move(begin() + (last - cbegin()), end(), target);
+            while (end() != new_end) {
+                --storage_.size;
+                storage_.destroy(storage_.size);
+            }
+        }
+        return target;
+    }
+
+    constexpr explicit operator bool() const noexcept { return !empty(); }
+
+   private:
+    friend constexpr auto operator==(const StaticArrayList& self,
+                                     const StaticArrayList& that) noexcept
+        -> bool {
+        if (self.size() != that.size()) {
+            return false;
+        }
+        for (size_type index = 0; index < self.size(); ++index) {
+            if (!(self[index] == that[index])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend constexpr auto operator!=(const StaticArrayList& self,
+                                     const StaticArrayList& that) noexcept
+        -> bool {
+        return !(self == that);
+    }
+
+    template <typename... Args>
+    constexpr auto raw_emplace_back(Args&&... args) -> value_type& {
+        storage_.construct(storage_.size, std::forward<Args>(args)...);
+        return storage_.ptr()[storage_.size++];
+    }
+
+    constexpr void ensure_in_range(const size_type index) const {
+        if (index >= size()) {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    constexpr void ensure_not_empty() const {
+        if (empty()) {
+            throw std::out_of_range("ArrayList is empty");
+        }
+    }
+
+    Storage storage_;
+};
+
+}  // namespace al
+
+#endif  // STATIC_ARRAY_LIST_HPP
@@ -0,0 +1,95 @@
+#ifndef USABLE_SIZE_ALLOCATOR_HPP
+#define USABLE_SIZE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "array_list.hpp"
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace al {
+
+namespace detail {
+
+/// The size malloc really set aside for `block`, at least what was asked for.
+inline auto usable_size(void* const block) noexcept -> size_t {
+#if defined(__APPLE__)
+    return ::malloc_size(block);
+#elif AL_MSVC
+    return ::_msize(block);
+#else
+    return ::malloc_usable_size(block);
+#endif
+}
+
+}  // namespace detail
+
+/// Allocator over `malloc` that reports the whole size class malloc handed
+/// out through `allocate_at_least`, so an ArrayList using it grows into the
+/// slack before reallocating. For standard libraries whose `std::allocator`
+/// does not offer `allocate_at_least` yet; with jemalloc or tcmalloc
+/// underneath, size classes make the slack worth having.
+template <class Type>
+class UsableSizeAllocator {
+    static_assert(alignof(Type) <= alignof(std::max_align_t),
+                  "Requires a type malloc can align");
+
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using is_always_equal = std::true_type;
+    // NOLINTEND
+
+    UsableSizeAllocator() noexcept = default;
+
+    template <class Other>
+    UsableSizeAllocator(  // NOLINT
+        const UsableSizeAllocator<Other>& /* other */) noexcept {}
+
+    AL_NODISCARD auto allocate(const size_t count) -> Type* {
+        return allocate_at_least(count).ptr;
+    }
+
+    AL_NODISCARD auto allocate_at_least(const size_t count)
+        -> AllocationResult<Type*> {
+        if (count > static_cast<size_t>(-1) / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        // malloc(0) may return null, which is not a failure.
+        void* const block =
+            std::malloc(count == 0 ? 1 : count * sizeof(Type));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        return {static_cast<Type*>(block),
+                detail::usable_size(block) / sizeof(Type)};
+    }
+
+    auto deallocate(Type* const ptr, const size_t /* count */) noexcept
+        -> void {
+        std::free(ptr);
+    }
+
+   private:
+    friend auto operator==(const UsableSizeAllocator& /* self */,
+                           const UsableSizeAllocator& /* that */) noexcept
+        -> bool {
+        return true;
+    }
+
+    friend auto operator!=(const UsableSizeAllocator& /* self */,
+                           const UsableSizeAllocator& /* that */) noexcept
+        -> bool {
+        return false;
+    }
+};
+
+}  // namespace al
+
+#endif  // USABLE_SIZE_ALLOCATOR_HPP
@@ -0,0 +1,148 @@
+#ifndef VIRTUAL_MEMORY_ALLOCATOR_HPP
+#define VIRTUAL_MEMORY_ALLOCATOR_HPP
+
+#include <new>
+
+#include "array_list.hpp"
+#include "detail/pages.hpp"
+
+namespace al {
+
+/// Allocator that reserves a fixed range of address space for every
+/// allocation and commits pages only as the allocation grows into them.
+/// ArrayList grows through `try_extend`, so up to the reservation the buffer
+/// never moves and growing never copies; `try_shrink` hands the pages past
+/// the end back to the kernel while keeping the range.
+///
+/// Allocations larger than the reservation are mapped, and committed, at
+/// their exact size.
+template <class Type>
+class VirtualMemoryAllocator {
+   public:
+    // NOLINTBEGIN
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    // NOLINTEND
+
+    static constexpr size_t DefaultReservation =
+        sizeof(void*) >= 8 ? size_t{64} << 30U : size_t{256} << 20U;
+
+    VirtualMemoryAllocator() noexcept
+        : VirtualMemoryAllocator(DefaultReservation) {}
+
+    /// Reserves `reservation` bytes, rounded up to whole pages, per
+    /// allocation.
+    explicit VirtualMemoryAllocator(const size_t reservation) noexcept
+        : reservation_(detail::round_to_pages(reservation)) {}
+
+    template <class Other>
+    VirtualMemoryAllocator(  // NOLINT
+        const VirtualMemoryAllocator<Other>& other) noexcept
+        : reservation_(other.reservation_) {}
+
+    AL_NODISCARD auto allocate(const size_t count) -> Type* {
+        if (count > static_cast<size_t>(-1) / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        const auto bytes = count * sizeof(Type);
+        const auto reserved = reserved_bytes(bytes);
+        void* const address =
+            ::mmap(nullptr, reserved, PROT_NONE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (address == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        if (!commit(address, 0, bytes)) {
+            ::munmap(address, reserved);
+            throw std::bad_alloc();
+        }
+        return static_cast<Type*>(address);
+    }
+
+    auto deallocate(Type* const ptr, const size_t count) noexcept -> void {
+        ::munmap(ptr, reserved_bytes(count * sizeof(Type)));
+    }
+
+    /// Commits the pages up to `new_count` elements if they fit in the
+    /// reservation.
+    AL_NODISCARD auto try_extend(Type* const ptr, const size_t old_count,
+                                 const size_t new_count) noexcept -> bool {
+        if (new_count > reservation_ / sizeof(Type)) {
+            return false;
+        }
+        return commit(ptr, old_count * sizeof(Type), new_count * sizeof(Type));
+    }
+
+    /// Decommits the pages past `new_count` elements, which read as zero if
+    /// they are committed again.
+    AL_NODISCARD auto try_shrink(Type* const ptr, const size_t old_count,
+                                 const size_t new_count) noexcept -> bool {
+        if (old_count > reservation_ / sizeof(Type)) {
+            return false;
+        }
+        decommit(ptr, new_count * sizeof(Type), old_count * sizeof(Type));
+        return true;
+    }
+
+    AL_NODISCARD auto reservation() const noexcept -> size_t {
+        return reservation_;
+    }
+
+   private:
+    template <class Other>
+    friend class VirtualMemoryAllocator;
+
+    auto reserved_bytes(const size_t bytes) const noexcept -> size_t {
+        return bytes > reservation_ ? detail::round_to_pages(bytes)
+                                    : reservation_;
+    }
+
+    static auto commit(void* const base, const size_t from,
+                       const size_t to) noexcept -> bool {
+        const auto first = detail::round_to_pages(from);
+        const auto last = detail::round_to_pages(to);
+        return first >= last or
+               ::mprotect(static_cast<unsigned char*>(base) + first,
+                          last - first, PROT_READ | PROT_WRITE) == 0;
+    }
+
+    static void decommit(void* const base, const size_t from,
+                         const size_t to) noexcept {
+        const auto first = detail::round_to_pages(from);
+        const auto last = detail::round_to_pages(to);
+        if (first >= last) {
+            return;
+        }
+        // Dropping the pages frees the memory, and taking away access
+        // returns the commit charge.
+        auto* const pages = static_cast<unsigned char*>(base) + first;
+        ::madvise(pages, last - first, MADV_DONTNEED);
+        ::mprotect(pages, last - first, PROT_NONE);
+    }
+
+    friend auto operator==(const VirtualMemoryAllocator& self,
+                           const VirtualMemoryAllocator& that) noexcept
+        -> bool {
+        return self.reservation_ == that.reservation_;
+    }
+
+    friend auto operator!=(const VirtualMemoryAllocator& self,
+                           const VirtualMemoryAllocator& that) noexcept
+        -> bool {
+        return self.reservation_ != that.reservation_;
+    }
+
+    size_t reservation_;
+};
+
+/// An ArrayList that never relocates while it fits in `reservation()` bytes,
+/// so `data()` and every reference stay valid as it grows.
+template <typename Type, typename GrowthPolicy = GeometricGrowth<>>
+using VirtualArrayList =
+    ArrayList<Type, VirtualMemoryAllocator<Type>, GrowthPolicy>;
+
+}  // namespace al
+
+#endif  // VIRTUAL_MEMORY_ALLOCATOR_HPP
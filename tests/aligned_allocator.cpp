@@ -0,0 +1,55 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <string>
+
+// ArrayList
+#include "al/aligned_allocator.hpp"
+#include "al/array_list.hpp"
+
+namespace {
+
+auto is_aligned(const void* const data, const std::size_t alignment) -> bool {
+    return reinterpret_cast<std::uintptr_t>(data) % alignment == 0;
+}
+
+}  // namespace
+
+TEST_CASE("AlignedArrayList keeps data() aligned as it grows") {
+    al::AlignedArrayList<float> list;
+    for (int i = 0; i < 10000; ++i) {
+        list.push_back(static_cast<float>(i));
+        REQUIRE(is_aligned(list.data(), 64));
+    }
+    REQUIRE(list[9999] == 9999.0F);
+
+    al::AlignedArrayList<std::string, 4096> pages;
+    pages.assign(100, "page");
+    REQUIRE(is_aligned(pages.data(), 4096));
+    pages.resize(1000);
+    pages.shrink_to_fit();
+    REQUIRE(is_aligned(pages.data(), 4096));
+    REQUIRE(pages[99] == "page");
+
+    const auto copy = pages;
+    REQUIRE(is_aligned(copy.data(), 4096));
+    REQUIRE(copy == pages);
+}
+
+TEST_CASE("HugePageArrayList moves to huge pages past its threshold") {
+    al::HugePageArrayList<std::uint64_t, 64 * 1024> list;
+    list.assign(1000, 1);
+    REQUIRE(is_aligned(list.data(), 64));
+
+    list.resize(100000);
+    REQUIRE(is_aligned(list.data(), al::HugePageSize));
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 0);
+
+    list.resize(10);
+    list.shrink_to_fit();
+    REQUIRE(is_aligned(list.data(), 64));
+    REQUIRE(list[9] == 1);
+}
@@ -0,0 +1,329 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <vector>
+
+// ArrayList
+#include "al/array_list.hpp"
+
+namespace {
+
+struct Counts {
+    int allocations = 0;
+    int deallocations = 0;
+    int constructions = 0;
+    int copies = 0;
+    int moves = 0;
+    int destructions = 0;
+};
+
+Counts counts;  // NOLINT
+
+/// Counts every allocation and deallocation made through it.
+template <class Type>
+struct CountingAllocator {
+    using value_type = Type;  // NOLINT
+
+    CountingAllocator() = default;
+
+    template <class Other>
+    CountingAllocator(const CountingAllocator<Other>& /* other */) noexcept {
+    }  // NOLINT
+
+    auto allocate(const size_t count) -> Type* {
+        ++counts.allocations;
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* const ptr, const size_t count) noexcept {
+        ++counts.deallocations;
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    friend auto operator==(const CountingAllocator& /* self */,
+                           const CountingAllocator& /* that */) noexcept
+        -> bool {
+        return true;
+    }
+
+    friend auto operator!=(const CountingAllocator& /* self */,
+                           const CountingAllocator& /* that */) noexcept
+        -> bool {
+        return false;
+    }
+};
+
+/// Counts every construction, copy, move and destruction.
+struct Counted {
+    Counted() noexcept { ++counts.constructions; }
+    explicit Counted(const int value) noexcept : value(value) {
+        ++counts.constructions;
+    }
+    Counted(const Counted& other) noexcept : value(other.value) {
+        ++counts.copies;
+    }
+    Counted(Counted&& other) noexcept : value(other.value) { ++counts.moves; }
+    auto operator=(const Counted& other) noexcept -> Counted& {
+        value = other.value;
+        ++counts.copies;
+        return *this;
+    }
+    auto operator=(Counted&& other) noexcept -> Counted& {
+        value = other.value;
+        ++counts.moves;
+        return *this;
+    }
+    ~Counted() { ++counts.destructions; }
+
+    int value = 0;
+};
+
+using List = al::ArrayList<Counted, CountingAllocator<Counted>>;
+
+auto make_list(const int size) -> List {
+    List list;
+    list.reserve(static_cast<size_t>(size));
+    for (int i = 0; i < size; ++i) {
+        list.emplace_back(i);
+    }
+    return list;
+}
+
+/// Resets the counters, so a test only sees what follows.
+void reset() { counts = Counts{}; }
+
+}  // namespace
+
+TEST_CASE("Allocation counts of construction") {
+    reset();
+
+    SECTION("Default and allocator constructed lists never allocate") {
+        List list;
+        List other{CountingAllocator<Counted>()};
+        REQUIRE(counts.allocations == 0);
+    }
+
+    SECTION("Capacity") {
+        List list(10);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.constructions == 0);
+    }
+
+    SECTION("Random access range") {
+        const std::vector<Counted> source(5);
+        reset();
+        const List list(source.begin(), source.end());
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.copies == 5);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(list.capacity() == 5);
+    }
+
+    SECTION("Forward range is counted before allocating") {
+        const std::forward_list<Counted> source(5);
+        reset();
+        const List list(source.begin(), source.end());
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.copies == 5);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(list.capacity() == 5);
+    }
+
+    SECTION("Input range grows like push_back") {
+        std::istringstream input("1 2 3 4 5");
+        const al::ArrayList<int, CountingAllocator<int>> list(
+            (std::istream_iterator<int>(input)), std::istream_iterator<int>());
+        // Growth to 1, 2, 3, 4, 6
+        REQUIRE(counts.allocations == 5);
+        REQUIRE(counts.deallocations == 4);
+        REQUIRE(list.size() == 5);
+    }
+
+    SECTION("Initializer list") {
+        const List list{Counted(1), Counted(2), Counted(3)};
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.copies == 3);
+    }
+
+    SECTION("Container is copied once") {
+        const std::vector<Counted> vector(4);
+        const std::list<Counted> list(4);
+        reset();
+        const List from_vector(vector);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.copies == 4);
+
+        const List from_list(list);
+        REQUIRE(counts.allocations == 2);
+        REQUIRE(counts.copies == 8);
+        REQUIRE(from_list.size() == 4);
+    }
+
+    SECTION("Copy") {
+        const auto source = make_list(6);
+        reset();
+        const List copy(source);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.copies == 6);
+        REQUIRE(copy.capacity() == 6);
+    }
+
+    SECTION("Move steals the buffer") {
+        auto source = make_list(6);
+        reset();
+        const List moved(std::move(source));
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 0);
+    }
+
+    SECTION("Empty copy") {
+        const List source;
+        const List copy(source);
+        REQUIRE(counts.allocations == 0);
+    }
+}
+
+TEST_CASE("Allocation counts of assignment") {
+    SECTION("Copy assignment reuses a big enough buffer") {
+        const auto source = make_list(4);
+        auto target = make_list(8);
+        reset();
+        target = source;
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.deallocations == 0);
+        REQUIRE(target.size() == 4);
+        REQUIRE(target.capacity() == 8);
+        REQUIRE(target[3].value == 3);
+    }
+
+    SECTION("Copy assignment into a smaller buffer allocates once") {
+        const auto source = make_list(8);
+        auto target = make_list(4);
+        reset();
+        target = source;
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.deallocations == 1);
+        REQUIRE(counts.copies == 8);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(target.capacity() == 8);
+    }
+
+    SECTION("Move assignment frees the old buffer only") {
+        auto source = make_list(4);
+        auto target = make_list(8);
+        reset();
+        target = std::move(source);
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.deallocations == 1);
+        REQUIRE(counts.copies == 0);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(counts.destructions == 8);
+    }
+}
+
+TEST_CASE("Allocation counts of assign") {
+    SECTION("Copy assignment assigns over live elements") {
+        const auto source = make_list(6);
+        auto target = make_list(4);
+        target.reserve(8);
+        reset();
+        target = source;
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.copies == 6);
+        REQUIRE(counts.destructions == 0);
+
+        const auto shorter = make_list(2);
+        reset();
+        target = shorter;
+        REQUIRE(counts.copies == 2);
+        REQUIRE(counts.destructions == 4);
+        REQUIRE(target.capacity() == 8);
+    }
+
+    SECTION("Repeated value") {
+        auto list = make_list(4);
+        reset();
+        list.assign(3, Counted(7));
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.copies == 3);
+        REQUIRE(counts.destructions == 1 + 1);
+
+        reset();
+        list.assign(10, Counted(8));
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.deallocations == 1);
+        REQUIRE(counts.copies == 10);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(list.capacity() == 10);
+    }
+
+    SECTION("Ranges") {
+        auto list = make_list(8);
+        const std::forward_list<Counted> source(5);
+        reset();
+        list.assign(source.begin(), source.end());
+        list.assign_range(source);
+        REQUIRE(counts.allocations == 0);
+        REQUIRE(counts.copies == 10);
+        REQUIRE(counts.destructions == 3);
+    }
+}
+
+TEST_CASE("Allocation counts of growth") {
+    reset();
+
+    SECTION("push_back sequence") {
+        {
+            List list;
+            for (int i = 0; i < 10; ++i) {
+                list.push_back(Counted(i));
+            }
+            // Growth to 1, 2, 3, 4, 6, 9, 13
+            REQUIRE(counts.allocations == 7);
+            REQUIRE(counts.deallocations == 6);
+            REQUIRE(counts.copies == 0);
+            REQUIRE(counts.moves == 10 + 1 + 2 + 3 + 4 + 6 + 9);
+        }
+        REQUIRE(counts.deallocations == counts.allocations);
+        REQUIRE(counts.destructions == counts.constructions + counts.moves);
+    }
+
+    SECTION("reserve then fill") {
+        List list;
+        list.reserve(100);
+        for (int i = 0; i < 100; ++i) {
+            list.emplace_back(i);
+        }
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.moves == 0);
+        REQUIRE(counts.copies == 0);
+
+        list.reserve(50);
+        list.reserve(100);
+        REQUIRE(counts.allocations == 1);
+    }
+
+    SECTION("resize") {
+        List list;
+        list.resize(10);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.constructions == 10);
+
+        list.resize(4);
+        list.resize(10);
+        REQUIRE(counts.allocations == 1);
+        REQUIRE(counts.destructions == 6);
+
+        list.resize(20);
+        REQUIRE(counts.allocations == 2);
+        REQUIRE(counts.deallocations == 1);
+        REQUIRE(counts.moves == 10);
+        REQUIRE(counts.copies == 0);
+    }
+}
@@ -0,0 +1,80 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <string>
+
+// ArrayList
+#include "al/arena_allocator.hpp"
+#include "al/array_list.hpp"
+
+TEST_CASE("Arena allocator grows the latest list in place") {
+    al::Arena arena;
+    al::ArenaAllocator<int> alloc(arena);
+
+    al::ArrayList<int, al::ArenaAllocator<int>> list(alloc);
+    list.push_back(0);
+    const auto* const data = list.data();
+
+    for (int i = 1; i < 1000; ++i) {
+        list.push_back(i);
+    }
+    REQUIRE(list.data() == data);
+    REQUIRE(list.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        REQUIRE(list[i] == i);
+    }
+    REQUIRE(arena.bytes_reserved() == al::Arena::DefaultBlockSize);
+}
+
+TEST_CASE("Arena allocator relocates once another allocation follows") {
+    al::Arena arena(256);
+    al::ArenaAllocator<std::string> alloc(arena);
+
+    al::ArrayList<std::string, al::ArenaAllocator<std::string>> first(alloc);
+    first.emplace_back("first");
+    al::ArrayList<std::string, al::ArenaAllocator<std::string>> second(alloc);
+    second.emplace_back("second");
+
+    const auto* const data = first.data();
+    for (int i = 0; i < 100; ++i) {
+        first.emplace_back(std::to_string(i));
+    }
+    REQUIRE(first.data() != data);
+    REQUIRE(first.front() == "first");
+    REQUIRE(first.back() == "99");
+    REQUIRE(second.front() == "second");
+
+    auto copy = first;
+    REQUIRE(copy == first);
+}
+
+#if AL_HAS_MEMORY_RESOURCE
+TEST_CASE("pmr ArrayList over an arena") {
+    al::Arena arena;
+    al::ArenaResource resource(arena);
+
+    al::pmr::ArrayList<int> list(
+        (std::pmr::polymorphic_allocator<int>(&resource)));
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+    REQUIRE(list.size() == 100);
+    REQUIRE(list.back() == 99);
+    REQUIRE(arena.bytes_reserved() > 0);
+
+    SECTION("Moving between resources moves the elements") {
+        al::pmr::ArrayList<int> other;
+        other = std::move(list);
+        REQUIRE(other.size() == 100);
+        REQUIRE(other.back() == 99);
+        REQUIRE(list.empty());  // NOLINT
+    }
+
+    SECTION("Moving construction keeps the buffer") {
+        const auto* const data = list.data();
+        auto moved = std::move(list);
+        REQUIRE(moved.data() == data);
+    }
+}
+#endif
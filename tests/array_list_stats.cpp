@@ -0,0 +1,126 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/array_list_stats.hpp"
+
+namespace {
+
+struct IngestTag {};
+
+}  // namespace
+
+TEST_CASE("NoStats costs nothing") {
+    static_assert(sizeof(al::ArrayList<int>) == 3 * sizeof(int*));
+}
+
+TEST_CASE("Per instance stats") {
+    al::TrackedArrayList<int, IngestTag> list;
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+
+    // Growth to 1, 2, 3, 4, 6, 9, 13
+    const auto& stats = list.stats().snapshot();
+    REQUIRE(stats.allocations == 1);
+    REQUIRE(stats.reallocations == 6);
+    REQUIRE(stats.elements_relocated == 1 + 2 + 3 + 4 + 6 + 9);
+    REQUIRE(stats.bytes_relocated == stats.elements_relocated * sizeof(int));
+    REQUIRE(stats.peak_capacity == 13);
+
+    list.resize(5);
+    REQUIRE(list.stats().snapshot().wasted_bytes == 8 * sizeof(int));
+
+    list.erase(list.cbegin(), list.cbegin() + 2);
+    REQUIRE(list.stats().snapshot().wasted_bytes == 10 * sizeof(int));
+
+    list.shrink_to_fit();
+    REQUIRE(list.stats().snapshot().reallocations == 7);
+    // realloc releases the old buffers of trivially relocatable types itself
+    REQUIRE(list.stats().snapshot().deallocations == 0);
+    REQUIRE(list.stats().snapshot().wasted_bytes == 0);
+}
+
+TEST_CASE("Wasted bytes follow every change of size") {
+    struct Tag {};
+    al::TrackedArrayList<int, Tag> list;
+    const auto requires_current_waste = [&list] {
+        REQUIRE(list.stats().snapshot().wasted_bytes ==
+                (list.capacity() - list.size()) * sizeof(int));
+    };
+
+    for (int i = 0; i < 8; ++i) {
+        list.push_back(i);
+        requires_current_waste();
+    }
+    list.emplace_back(8);
+    requires_current_waste();
+    const int more[] = {9, 10};
+    list.push_back(std::begin(more), std::end(more));
+    requires_current_waste();
+    list.append_with(list.capacity() - list.size(),
+                     [](int* out, const std::size_t count) {
+                         for (std::size_t i = 0; i < count; ++i) {
+                             out[i] = 0;
+                         }
+                         return count;
+                     });
+    REQUIRE(list.stats().snapshot().wasted_bytes == 0);
+    list.insert(list.cbegin(), 42);
+    requires_current_waste();
+    list.insert(list.cbegin() + 1, 43);
+    requires_current_waste();
+    list.emplace(list.cend(), 44);
+    requires_current_waste();
+    list.append_uninitialized(3);
+    requires_current_waste();
+    list.pop_back();
+    requires_current_waste();
+    list.swap_remove(0);
+    requires_current_waste();
+    list.erase(list.cbegin());
+    requires_current_waste();
+    list.reserve(100);
+    requires_current_waste();
+}
+
+TEST_CASE("Relocating stats") {
+    struct Tag {};
+    al::TrackedArrayList<std::string, Tag> list;
+    for (int i = 0; i < 4; ++i) {
+        list.emplace_back("value");
+    }
+    REQUIRE(list.stats().snapshot().allocations == 1);
+    REQUIRE(list.stats().snapshot().reallocations == 3);
+    REQUIRE(list.stats().snapshot().deallocations == 3);
+}
+
+TEST_CASE("Process wide stats") {
+    struct Tag {};
+    {
+        al::TrackedArrayList<std::string, Tag> first;
+        first.reserve(100);
+        al::TrackedArrayList<std::string, Tag> second(first);
+        second.push_back("x");
+    }
+
+    const auto totals = al::array_list_stats<Tag>();
+    REQUIRE(totals.allocations == 2);
+    REQUIRE(totals.deallocations == 2);
+    REQUIRE(totals.peak_capacity == 100);
+    REQUIRE(totals.wasted_bytes == 100 * sizeof(std::string));
+
+    std::ostringstream out;
+    al::dump_array_list_stats(out);
+    REQUIRE(out.str().find("Tag: allocations=2") != std::string::npos);
+
+    al::reset_array_list_stats();
+    REQUIRE(al::array_list_stats<Tag>().allocations == 0);
+}
@@ -0,0 +1,241 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <algorithm>
+#include <atomic>
+#include <forward_list>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ArrayList
+#include "al/concurrent_array_list.hpp"
+#include "detail.hpp"
+
+namespace {
+
+using detail::CopyLimited;
+
+bool fail_allocation = false;  // NOLINT
+
+/// Throws `std::bad_alloc` from the next allocation once told to.
+template <class Type>
+struct FailingAllocator {
+    using value_type = Type;  // NOLINT
+
+    FailingAllocator() = default;
+
+    template <class Other>
+    FailingAllocator(const FailingAllocator<Other>& /* other */) noexcept {
+    }  // NOLINT
+
+    auto allocate(const size_t count) -> Type* {
+        if (fail_allocation) {
+            fail_allocation = false;
+            throw std::bad_alloc();
+        }
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* const ptr, const size_t count) noexcept {
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    friend auto operator==(const FailingAllocator& /* self */,
+                           const FailingAllocator& /* that */) noexcept
+        -> bool {
+        return true;
+    }
+
+    friend auto operator!=(const FailingAllocator& /* self */,
+                           const FailingAllocator& /* that */) noexcept
+        -> bool {
+        return false;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Segments double in size") {
+    using Segments = al::detail::Segments<4>;
+    REQUIRE(Segments::segment_of(0) == 0);
+    REQUIRE(Segments::segment_of(3) == 0);
+    REQUIRE(Segments::segment_of(4) == 1);
+    REQUIRE(Segments::segment_of(11) == 1);
+    REQUIRE(Segments::segment_of(12) == 2);
+    REQUIRE(Segments::start_of(2) == 12);
+    REQUIRE(Segments::size_of(2) == 16);
+    for (size_t index = 0; index < 10000; ++index) {
+        const auto segment = Segments::segment_of(index);
+        REQUIRE(index >= Segments::start_of(segment));
+        REQUIRE(index <
+                Segments::start_of(segment) + Segments::size_of(segment));
+    }
+}
+
+TEST_CASE("ConcurrentArrayList on one thread") {
+    al::ConcurrentArrayList<std::string> list;
+    REQUIRE(list.empty());
+
+    SECTION("References stay valid as it grows") {
+        auto& first = list.push_back("first");
+        for (int i = 0; i < 1000; ++i) {
+            list.emplace_back(std::to_string(i));
+        }
+        REQUIRE(&first == &list[0]);
+        REQUIRE(first == "first");
+        REQUIRE(list.size() == 1001);
+        REQUIRE(list[1000] == "999");
+        REQUIRE_THROWS_AS(list.at(1001), std::out_of_range);
+    }
+
+    SECTION("Bulk appends are contiguous across segments") {
+        list.push_back("a");
+        REQUIRE(list.append(100, "b") == 1);
+        const std::forward_list<std::string> forward{"c", "d"};
+        REQUIRE(list.append(forward.begin(), forward.end()) == 101);
+        std::istringstream input("e f");
+        REQUIRE(list.append(std::istream_iterator<std::string>(input),
+                            std::istream_iterator<std::string>()) == 103);
+        REQUIRE(list.size() == 105);
+        REQUIRE(list[100] == "b");
+        REQUIRE(list[102] == "d");
+        REQUIRE(list[104] == "f");
+    }
+
+    SECTION("freeze makes it contiguous and empties it") {
+        for (int i = 0; i < 500; ++i) {
+            list.push_back(std::to_string(i));
+        }
+        const auto frozen = list.freeze();
+        REQUIRE(frozen.size() == 500);
+        REQUIRE(frozen[0] == "0");
+        REQUIRE(frozen[499] == "499");
+        REQUIRE(list.empty());
+
+        list.push_back("again");
+        REQUIRE(list[0] == "again");
+    }
+
+    SECTION("for_each visits in order") {
+        for (int i = 0; i < 100; ++i) {
+            list.push_back(std::to_string(i));
+        }
+        int expected = 0;
+        list.for_each([&expected](const std::string& value) {
+            REQUIRE(value == std::to_string(expected++));
+        });
+        REQUIRE(expected == 100);
+    }
+}
+
+TEST_CASE("ConcurrentArrayList does not claim slots for throwing copies") {
+    al::ConcurrentArrayList<CopyLimited> list;
+    CopyLimited::copies = 0;
+    CopyLimited::limit = 3;
+    const CopyLimited value(7);
+
+    list.push_back(value);
+    REQUIRE_THROWS_AS(list.append(5, value), std::runtime_error);
+    REQUIRE(list.size() == 1);
+    list.push_back(CopyLimited(8));
+    REQUIRE(list.size() == 2);
+    REQUIRE(list[1].value == 8);
+}
+
+TEST_CASE("ConcurrentArrayList skips slots it could not allocate") {
+    using List =
+        al::ConcurrentArrayList<std::string, FailingAllocator<std::string>>;
+    List list;
+    for (size_t i = 0; i < List::FirstSegmentSize; ++i) {
+        list.push_back("kept");
+    }
+    fail_allocation = true;
+    REQUIRE_THROWS_AS(list.push_back("lost"), std::bad_alloc);
+    REQUIRE(list.size() == List::FirstSegmentSize + 1);
+
+    list.push_back("after");
+    size_t visited = 0;
+    list.for_each([&visited](const std::string&) { ++visited; });
+    REQUIRE(visited == List::FirstSegmentSize + 1);
+
+    const auto frozen = list.freeze();
+    REQUIRE(frozen.size() == List::FirstSegmentSize + 1);
+    REQUIRE(frozen.back() == "after");
+}
+
+TEST_CASE("ConcurrentArrayList merges holes past MaxHoles") {
+    using List = al::ConcurrentArrayList<int, FailingAllocator<int>>;
+    using Segments = al::detail::Segments<List::FirstSegmentSize>;
+    constexpr int Rounds = static_cast<int>(List::MaxHoles) + 2;
+    List list;
+    for (size_t i = 0; i < List::FirstSegmentSize; ++i) {
+        list.push_back(0);
+    }
+    // Each round appends one element, then fails an append reaching into
+    // the next segment, so every hole has one element after it.
+    for (int round = 0; round < Rounds; ++round) {
+        list.push_back(round + 1);
+        const auto segment = Segments::segment_of(list.size());
+        const auto rest = Segments::start_of(segment) +
+                          Segments::size_of(segment) - list.size() + 1;
+        fail_allocation = true;
+        REQUIRE_THROWS_AS(list.append(rest, -1), std::bad_alloc);
+    }
+
+    // Two merges, each dropping the element between the holes it joined.
+    std::vector<int> visited;
+    list.for_each([&visited](const int value) { visited.push_back(value); });
+    REQUIRE(visited.size() == List::FirstSegmentSize + Rounds - 2);
+    REQUIRE(std::count(visited.begin(), visited.end(), -1) == 0);
+    REQUIRE(std::is_sorted(visited.begin(), visited.end()));
+    REQUIRE(visited.back() == Rounds);
+
+    const auto frozen = list.freeze();
+    REQUIRE(frozen.size() == visited.size());
+}
+
+TEST_CASE("ConcurrentArrayList with many producers") {
+    constexpr int Producers = 8;
+    constexpr int PerProducer = 20000;
+    al::ConcurrentArrayList<int> list;
+    // Catch assertions are not thread-safe, so producers only count.
+    std::atomic<int> misread{0};
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < Producers; ++producer) {
+        producers.emplace_back([&list, &misread, producer] {
+            for (int i = 0; i < PerProducer; ++i) {
+                if (i % 100 == 0) {
+                    const int batch[] = {-1, -1};
+                    list.append(std::begin(batch), std::end(batch));
+                }
+                auto& element = list.push_back(producer * PerProducer + i);
+                // Each producer can read back what it appended.
+                if (element != producer * PerProducer + i) {
+                    ++misread;
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(misread == 0);
+    REQUIRE(list.size() == Producers * (PerProducer + PerProducer / 50));
+    auto frozen = list.freeze();
+    frozen.erase(std::remove(frozen.begin(), frozen.end(), -1), frozen.end());
+    std::sort(frozen.begin(), frozen.end());
+    REQUIRE(frozen.size() == Producers * PerProducer);
+    for (int value = 0; value < Producers * PerProducer; ++value) {
+        if (frozen[static_cast<size_t>(value)] != value) {
+            FAIL("Missing " << value);
+        }
+    }
+}
@@ -1,5 +1,11 @@
 #pragma once
 
+// StdLib
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
 namespace detail {
 
 template <template <typename...> class Template>
@@ -8,4 +14,70 @@ struct TemplateIdentity {
     using type = Template<Ts...>;  // NOLINT
 };
 
+/// Fails to copy once `limit` copies have been made, and counts the live
+/// instances. Moves never throw.
+struct CopyLimited {
+    static inline int copies = 0;
+    static inline int limit = 0;
+    static inline int live = 0;
+
+    explicit CopyLimited(const int value = 0) : value(value) { ++live; }
+    CopyLimited(const CopyLimited& other) : value(other.value) {
+        if (++copies > limit) {
+            throw std::runtime_error("CopyLimited");
+        }
+        ++live;
+    }
+    CopyLimited(CopyLimited&& other) noexcept : value(other.value) { ++live; }
+    auto operator=(const CopyLimited&) -> CopyLimited& = default;
+    auto operator=(CopyLimited&&) noexcept -> CopyLimited& = default;
+    ~CopyLimited() { --live; }
+
+    int value;
+};
+
+/// Blocks each TaggedAllocator tag has handed out and not taken back.
+inline int live_blocks[2] = {0, 0};  // NOLINT
+
+/// Unequal when the tags differ and does not move along with the elements,
+/// so a list has to give back what it allocated itself. Copies do carry it
+/// over, so a copied-into list has to free its buffer first.
+template <class Type>
+struct TaggedAllocator {
+    // NOLINTBEGIN
+    using value_type = Type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    // NOLINTEND
+
+    explicit TaggedAllocator(const int tag) noexcept : tag(tag) {}
+
+    template <class Other>
+    TaggedAllocator(  // NOLINT
+        const TaggedAllocator<Other>& other) noexcept
+        : tag(other.tag) {}
+
+    auto allocate(const size_t count) -> Type* {
+        ++live_blocks[tag];
+        return std::allocator<Type>().allocate(count);
+    }
+
+    void deallocate(Type* const ptr, const size_t count) noexcept {
+        --live_blocks[tag];
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    friend auto operator==(const TaggedAllocator& self,
+                           const TaggedAllocator& that) noexcept -> bool {
+        return self.tag == that.tag;
+    }
+
+    friend auto operator!=(const TaggedAllocator& self,
+                           const TaggedAllocator& that) noexcept -> bool {
+        return self.tag != that.tag;
+    }
+
+    int tag;
+};
+
 }  // namespace detail
@@ -0,0 +1,161 @@
+#if defined(__unix__) || defined(__APPLE__)
+
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+// POSIX
+#include <unistd.h>
+
+// ArrayList
+#include "al/mapped_array_list.hpp"
+
+namespace {
+
+struct Point {
+    std::int32_t x;
+    std::int32_t y;
+};
+
+using Points = al::MappedArrayList<Point>;
+
+/// A file name of its own in the temporary directory, removed afterwards.
+class TempFile {
+   public:
+    TempFile()
+        : path_(std::filesystem::temp_directory_path() /
+                ("al-mapped-" + std::to_string(::getpid()) + "-" +
+                 std::to_string(counter++))) {}
+    TempFile(const TempFile&) = delete;
+    auto operator=(const TempFile&) -> TempFile& = delete;
+    ~TempFile() { std::filesystem::remove(path_); }
+
+    auto path() const -> std::string { return path_.string(); }
+
+    auto bytes() const -> std::uintmax_t {
+        return std::filesystem::file_size(path_);
+    }
+
+   private:
+    static inline int counter = 0;
+    std::filesystem::path path_;
+};
+
+}  // namespace
+
+TEST_CASE("MappedArrayList keeps its elements across reopening") {
+    const TempFile file;
+    {
+        Points list(file.path());
+        REQUIRE(list.is_open());
+        REQUIRE(list.empty());
+        for (std::int32_t i = 0; i < 10000; ++i) {
+            list.push_back({i, -i});
+        }
+        REQUIRE(list.size() == 10000);
+        REQUIRE(list.capacity() >= 10000);
+    }
+
+    Points list(file.path());
+    REQUIRE(list.size() == 10000);
+    REQUIRE(list[1234].x == 1234);
+    REQUIRE(list.back().y == -9999);
+    REQUIRE_THROWS_AS(list.at(10000), std::out_of_range);
+
+    SECTION("Appends may name elements of the list itself") {
+        const auto capacity = list.capacity();
+        while (list.size() < capacity) {
+            list.emplace_back(list[list.size() - 10000]);
+        }
+        list.emplace_back(list[1]);
+        REQUIRE(list.back().x == 1);
+
+        const auto size = list.size();
+        list.shrink_to_fit();
+        list.append(list.begin(), list.end());
+        REQUIRE(list.size() == 2 * size);
+        REQUIRE(list[size + 42].y == -42);
+    }
+
+    SECTION("flush records the size for other readers") {
+        list.resize(20000);
+        REQUIRE(list[15000].x == 0);
+        list[15000].x = 15;
+        list.flush();
+        const Points reader(file.path());
+        REQUIRE(reader.size() == 20000);
+        REQUIRE(reader[15000].x == 15);
+    }
+
+    SECTION("shrink_to_fit gives pages back to the file system") {
+        const auto before = file.bytes();
+        list.resize(10);
+        list.shrink_to_fit();
+        REQUIRE(file.bytes() < before);
+        REQUIRE(file.bytes() % static_cast<std::uintmax_t>(
+                                   ::sysconf(_SC_PAGESIZE)) ==
+                0);
+        REQUIRE(list.capacity() >= 10);
+        REQUIRE(list[9].x == 9);
+        list.reserve(100000);
+        REQUIRE(list.capacity() >= 100000);
+        REQUIRE(list[9].y == -9);
+    }
+
+    SECTION("Every advice is accepted") {
+        list.advise(al::MappedAdvice::Sequential);
+        list.advise(al::MappedAdvice::Random);
+        list.advise(al::MappedAdvice::WillNeed);
+        list.advise(al::MappedAdvice::Normal);
+        REQUIRE(std::accumulate(list.begin(), list.end(), std::int64_t{0},
+                                [](const std::int64_t sum, const Point& p) {
+                                    return sum + p.x;
+                                }) == 9999LL * 10000 / 2);
+    }
+
+    SECTION("Moves hand the mapping over") {
+        auto moved = std::move(list);
+        REQUIRE(moved.size() == 10000);
+        REQUIRE_FALSE(list.is_open());  // NOLINT
+        moved.clear();
+        moved.close();
+        REQUIRE(Points(file.path()).empty());
+    }
+}
+
+TEST_CASE("MappedArrayList keeps an empty list intact") {
+    const TempFile file;
+    {
+        Points list(file.path());
+        REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+        REQUIRE_THROWS_AS(list.front(), std::out_of_range);
+        const auto& view = list;
+        REQUIRE_THROWS_AS(view.back(), std::out_of_range);
+    }
+
+    const Points list(file.path());
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("MappedArrayList rejects files it did not write") {
+    const TempFile file;
+    {
+        Points list(file.path());
+        list.push_back({1, 2});
+    }
+    REQUIRE_THROWS_AS(al::MappedArrayList<std::int32_t>(file.path()),
+                      std::runtime_error);
+    std::filesystem::resize_file(file.path(), 16);
+    REQUIRE_THROWS_AS(Points(file.path()), std::runtime_error);
+    REQUIRE_THROWS_AS(Points("/nonexistent-directory/list"),
+                      std::system_error);
+}
+
+#endif
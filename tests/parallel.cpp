@@ -0,0 +1,198 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/parallel.hpp"
+
+namespace {
+
+auto iota_list(const size_t size) -> al::ArrayList<int> {
+    al::ArrayList<int> list;
+    list.resize(size);
+    std::iota(list.begin(), list.end(), 0);
+    return list;
+}
+
+/// Throws once it has been constructed `limit` times, counting live copies.
+struct Fragile {
+    static inline std::atomic<int> constructed{0};
+    static inline std::atomic<int> live{0};
+    static inline int limit = 0;
+
+    explicit Fragile(const int value) : value(value) {
+        if (++constructed > limit) {
+            throw std::runtime_error("Fragile");
+        }
+        ++live;
+    }
+    Fragile(const Fragile& other) : Fragile(other.value) {}
+    ~Fragile() { --live; }
+
+    int value;
+};
+
+}  // namespace
+
+TEST_CASE("Parallel algorithms match the serial ones") {
+    // Four threads even on a small machine, so the chunks really are split.
+    al::parallel::ThreadPool pool(4);
+    const size_t sizes[] = {0, 1, 1000, 100003, 1000000};
+
+    SECTION("for_each") {
+        for (const auto size : sizes) {
+            auto list = iota_list(size);
+            al::parallel::for_each(list, [](int& value) { value *= 2; }, pool);
+            auto expected = iota_list(size);
+            for (auto& value : expected) {
+                value *= 2;
+            }
+            REQUIRE(list == expected);
+        }
+    }
+
+    SECTION("transform appends in order") {
+        for (const auto size : sizes) {
+            const auto list = iota_list(size);
+            al::ArrayList<std::string> output{"first"};
+            al::parallel::transform(
+                list, output,
+                [](const int value) { return std::to_string(value); }, pool);
+            REQUIRE(output.size() == size + 1);
+            REQUIRE(output[0] == "first");
+            for (size_t index = 0; index < size; index += 997) {
+                REQUIRE(output[index + 1] == std::to_string(index));
+            }
+        }
+    }
+
+    SECTION("reduce keeps the order of the elements") {
+        for (const auto size : sizes) {
+            const auto list = iota_list(size);
+            const auto sum = al::parallel::reduce(
+                list, 0LL,
+                [](const long long total, const long long value) {
+                    return total + value;
+                },
+                pool);
+            const auto count = static_cast<long long>(size);
+            REQUIRE(sum == count * (count - 1) / 2);
+        }
+
+        // Concatenation is associative but not commutative.
+        al::ArrayList<std::string> words;
+        for (size_t index = 0; index < 100000; ++index) {
+            words.push_back(std::to_string(index % 10));
+        }
+        const auto joined = al::parallel::reduce(
+            words, std::string(),
+            [](std::string total, const std::string& word) {
+                return total += word;
+            },
+            pool);
+        REQUIRE(joined ==
+                std::accumulate(words.begin(), words.end(), std::string()));
+    }
+
+    SECTION("copy_if") {
+        for (const auto size : sizes) {
+            const auto list = iota_list(size);
+            al::ArrayList<int> output;
+            output.reserve(size);
+            const auto* const data = output.data();
+            const auto copied = al::parallel::copy_if(
+                list, output, [](const int value) { return value % 3 == 0; },
+                pool);
+            REQUIRE(copied == (size + 2) / 3);
+            REQUIRE(output.data() == data);
+
+            al::ArrayList<int> expected;
+            std::copy_if(list.begin(), list.end(), std::back_inserter(expected),
+                         [](const int value) { return value % 3 == 0; });
+            REQUIRE(output == expected);
+        }
+    }
+
+    SECTION("sort") {
+        for (const auto size : sizes) {
+            auto list = iota_list(size);
+            std::shuffle(list.begin(), list.end(),
+                         std::mt19937(static_cast<unsigned>(size)));
+            al::parallel::sort(list, std::greater<int>(), pool);
+            REQUIRE(list.size() == size);
+            REQUIRE(
+                std::is_sorted(list.begin(), list.end(), std::greater<int>()));
+        }
+    }
+}
+
+TEST_CASE("Parallel algorithms on slices and the default pool") {
+    auto list = iota_list(200000);
+    std::reverse(list.begin() + 1000, list.end() - 1000);
+    al::parallel::sort(list.begin() + 1000, list.end() - 1000);
+    REQUIRE(list == iota_list(200000));
+
+    std::atomic<long long> visited{0};
+    al::parallel::for_each(list.begin() + 10, list.begin() + 110000,
+                           [&visited](const int) { ++visited; });
+    REQUIRE(visited == 109990);
+}
+
+TEST_CASE("Parallel algorithms nest") {
+    al::parallel::ThreadPool pool(3);
+    al::ArrayList<al::ArrayList<int>> lists;
+    for (int i = 0; i < 8; ++i) {
+        lists.push_back(iota_list(50000));
+    }
+    al::parallel::for_each(
+        lists,
+        [&pool](al::ArrayList<int>& list) {
+            al::parallel::sort(list, std::greater<int>(), pool);
+        },
+        pool);
+    for (const auto& list : lists) {
+        REQUIRE(list.front() == 49999);
+        REQUIRE(std::is_sorted(list.begin(), list.end(), std::greater<int>()));
+    }
+}
+
+TEST_CASE("Parallel algorithms propagate exceptions") {
+    al::parallel::ThreadPool pool(4);
+    const auto list = iota_list(100000);
+
+    SECTION("for_each rethrows on the calling thread") {
+        REQUIRE_THROWS_AS(
+            al::parallel::for_each(
+                list,
+                [](const int value) {
+                    if (value == 77777) {
+                        throw std::runtime_error("for_each");
+                    }
+                },
+                pool),
+            std::runtime_error);
+    }
+
+    SECTION("transform destroys what it constructed") {
+        Fragile::constructed = 0;
+        Fragile::live = 0;
+        Fragile::limit = 60000;
+        al::ArrayList<Fragile> output;
+        REQUIRE_THROWS_AS(al::parallel::transform(
+                              list, output,
+                              [](const int value) { return Fragile(value); },
+                              pool),
+                          std::runtime_error);
+        REQUIRE(output.empty());
+        REQUIRE(Fragile::live == 0);
+    }
+}
@@ -0,0 +1,218 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/array_list_stats.hpp"
+#include "al/read_into.hpp"
+
+namespace {
+
+struct Record {
+    std::uint64_t id;
+    double value;
+};
+
+auto record_bytes(const std::uint64_t count) -> std::string {
+    std::string bytes;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        const Record record{i, i * 0.25};
+        bytes.append(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+    return bytes;
+}
+
+auto matches(const al::ArrayList<Record>& list, const std::uint64_t from,
+             const std::uint64_t count) -> bool {
+    for (std::uint64_t i = 0; i < count; ++i) {
+        const auto& record = list[static_cast<size_t>(from + i)];
+        if (record.id != i or record.value != i * 0.25) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Parses one integer per line.
+auto parse_lines(al::ArrayList<int>& list, const char* const data,
+                 const size_t size, const bool last) -> size_t {
+    size_t used = 0;
+    for (size_t end = 0; end < size; ++end) {
+        if (data[end] == '\n') {
+            list.push_back(std::stoi(std::string(data + used, end - used)));
+            used = end + 1;
+        }
+    }
+    if (last and used < size) {
+        list.push_back(std::stoi(std::string(data + used, size - used)));
+        used = size;
+    }
+    return used;
+}
+
+auto numbered_lines(const int count) -> std::string {
+    std::string text;
+    for (int i = 0; i < count; ++i) {
+        text += std::to_string(i * 37) + '\n';
+    }
+    return text;
+}
+
+}  // namespace
+
+TEST_CASE("read_into appends raw elements in chunks") {
+    const auto bytes = record_bytes(5000);
+    al::ReadOptions options;
+    options.chunk_bytes = 1000;
+    options.background = GENERATE(false, true);
+
+    SECTION("From a stream, reserving once for what is left") {
+        std::istringstream in(bytes);
+        al::ArrayList<Record> list;
+        list.push_back({99, 0});
+        REQUIRE(al::read_into(list, in, options) == 5000);
+        REQUIRE(list.size() == 5001);
+        REQUIRE(list.capacity() == 5002);
+        REQUIRE(matches(list, 1, 5000));
+    }
+
+    SECTION("From a FILE") {
+        std::FILE* const file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        std::fwrite(bytes.data(), 1, bytes.size(), file);
+        std::rewind(file);
+        al::ArrayList<Record> list;
+        REQUIRE(al::read_into(list, file, options) == 5000);
+        REQUIRE(matches(list, 0, 5000));
+        std::fclose(file);
+    }
+
+    SECTION("Without a size hint") {
+        std::istringstream in(bytes);
+        options.use_size_hint = false;
+        al::ArrayList<Record> list;
+        REQUIRE(al::read_into(list, in, options) == 5000);
+        REQUIRE(matches(list, 0, 5000));
+    }
+
+    SECTION("Keeping whole elements when the input ends inside one") {
+        std::istringstream in(bytes.substr(0, bytes.size() - 3));
+        al::ArrayList<Record> list;
+        REQUIRE_THROWS_AS(al::read_into(list, in, options),
+                          std::runtime_error);
+        REQUIRE(list.size() == 4999);
+        REQUIRE(matches(list, 0, 4999));
+    }
+
+    SECTION("With a chunk size of zero") {
+        std::istringstream in(bytes);
+        options.chunk_bytes = 0;
+        al::ArrayList<Record> list;
+        REQUIRE(al::read_into(list, in, options) == 5000);
+        REQUIRE(matches(list, 0, 5000));
+    }
+}
+
+#if AL_HAS_POSIX_IO
+TEST_CASE("read_into reads a file descriptor") {
+    const auto bytes = record_bytes(20000);
+    al::ReadOptions options;
+    options.chunk_bytes = 4096;
+    options.background = GENERATE(false, true);
+
+    SECTION("A regular file") {
+        std::FILE* const file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        std::fwrite(bytes.data(), 1, bytes.size(), file);
+        std::fflush(file);
+        const al::FileDescriptor fd{::fileno(file)};
+        REQUIRE(::lseek(fd.fd, 0, SEEK_SET) == 0);
+        al::ArrayList<Record> list;
+        REQUIRE(al::read_into(list, fd, options) == 20000);
+        REQUIRE(list.capacity() == 20001);
+        REQUIRE(matches(list, 0, 20000));
+        std::fclose(file);
+    }
+
+    SECTION("A pipe, which has no size to reserve for") {
+        int ends[2];
+        REQUIRE(::pipe(ends) == 0);
+        std::thread writer([&bytes, &ends] {
+            al::detail::write_all(al::FileDescriptor{ends[1]},
+                                  {al::detail::ByteSpan{bytes.data(),
+                                                        bytes.size()}});
+            ::close(ends[1]);
+        });
+        al::ArrayList<Record> list;
+        REQUIRE(al::read_into(list, al::FileDescriptor{ends[0]}, options) ==
+                20000);
+        writer.join();
+        ::close(ends[0]);
+        REQUIRE(matches(list, 0, 20000));
+    }
+}
+#endif
+
+TEST_CASE("read_into appends records as a parser finds them") {
+    al::ReadOptions options;
+    options.chunk_bytes = 7;
+    options.background = GENERATE(false, true);
+    al::ArrayList<int> list;
+
+    SECTION("Carrying records cut by chunk edges into the next chunk") {
+        std::istringstream in(numbered_lines(1000) + "12345");
+        REQUIRE(al::read_into(list, in, parse_lines, options) == 1001);
+        REQUIRE(list[999] == 999 * 37);
+        REQUIRE(list.back() == 12345);
+    }
+
+    SECTION("Growing the buffer for records longer than a chunk") {
+        std::istringstream in("1\n" + std::string(50, '0') + "42\n3\n");
+        REQUIRE(al::read_into(list, in, parse_lines, options) == 3);
+        REQUIRE(list[1] == 42);
+        REQUIRE(list[2] == 3);
+    }
+
+    SECTION("Failing when the parser leaves bytes at the end") {
+        std::istringstream in(numbered_lines(10) + "7");
+        const auto lines_only = [](al::ArrayList<int>& out,
+                                   const char* const data, const size_t size,
+                                   bool /* last */) {
+            return parse_lines(out, data, size, false);
+        };
+        REQUIRE_THROWS_AS(al::read_into(list, in, lines_only, options),
+                          std::runtime_error);
+        REQUIRE(list.size() == 10);
+    }
+}
+
+TEST_CASE("read_into records into a list's stats policy") {
+    struct ReadTag {};
+    std::istringstream in(record_bytes(1000));
+    al::TrackedArrayList<Record, ReadTag> list;
+    REQUIRE(al::read_into(list, in) == 1000);
+    REQUIRE(list.stats().snapshot().allocations == 1);
+    REQUIRE(list.stats().snapshot().reallocations == 0);
+
+    std::istringstream text(numbered_lines(100));
+    al::TrackedArrayList<int, ReadTag> lines;
+    const auto count_lines = [](auto& out, const char* const data,
+                                const size_t size, bool /* last */) {
+        for (size_t index = 0; index < size; ++index) {
+            if (data[index] == '\n') {
+                out.push_back(static_cast<int>(index));
+            }
+        }
+        return size;
+    };
+    REQUIRE(al::read_into(lines, text, count_lines) == 100);
+    REQUIRE(lines.stats().snapshot().allocations == 1);
+}
@@ -0,0 +1,207 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// ArrayList
+#include "al/segmented_array_list.hpp"
+#include "detail.hpp"
+
+namespace {
+
+using detail::CopyLimited;
+
+}  // namespace
+
+TEST_CASE("SegmentedArrayList never moves its elements") {
+    al::SegmentedArrayList<std::string> list;
+    REQUIRE(list.empty());
+    REQUIRE(list.capacity() == 0);
+    REQUIRE_THROWS_AS(list.front(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.back(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+
+    auto& first = list.push_back("first");
+    const auto* const address = &first;
+    for (int i = 0; i < 10000; ++i) {
+        list.emplace_back(std::to_string(i));
+    }
+    REQUIRE(&list[0] == address);
+    REQUIRE(first == "first");
+    REQUIRE(list.size() == 10001);
+    REQUIRE(list.capacity() >= list.size());
+    REQUIRE(list.back() == "9999");
+    REQUIRE(list[5000] == "4999");
+    REQUIRE_THROWS_AS(list.at(10001), std::out_of_range);
+
+    SECTION("reserve and shrink_to_fit only touch whole segments") {
+        const auto* const middle = &list[5000];
+        list.reserve(1'000'000);
+        REQUIRE(list.capacity() >= 1'000'000);
+        REQUIRE(&list[5000] == middle);
+        list.push_back("reserved");
+        REQUIRE(list.back() == "reserved");
+        list.resize(100);
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 32 + 64 + 128);
+        REQUIRE(&list[0] == address);
+        list.clear();
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 0);
+    }
+
+    SECTION("resize and pop_back") {
+        list.resize(3);
+        REQUIRE(list.size() == 3);
+        list.resize(40, "x");
+        REQUIRE(list[39] == "x");
+        list.pop_back();
+        REQUIRE(list.size() == 39);
+        REQUIRE(list.back() == "x");
+    }
+}
+
+TEST_CASE("SegmentedArrayList appends into reserved segments") {
+    al::SegmentedArrayList<int> list;
+    list.resize(al::SegmentedArrayList<int>::FirstSegmentSize);
+    list.reserve(100);
+    const auto capacity = list.capacity();
+    list.push_back(1);
+    list.push_back(2);
+    REQUIRE(list.capacity() == capacity);
+    REQUIRE(list.size() == 34);
+    REQUIRE(list.back() == 2);
+    list.pop_back();
+    list.pop_back();
+    list.pop_back();
+    list.push_back(3);
+    REQUIRE(list.size() == 32);
+    REQUIRE(list[31] == 3);
+}
+
+TEST_CASE("SegmentedArrayList iterators") {
+    al::SegmentedArrayList<int> list;
+    for (int i = 0; i < 1000; ++i) {
+        list.push_back(999 - i);
+    }
+
+    SECTION("Walk across segments in index order") {
+        int expected = 999;
+        for (const auto value : list) {
+            REQUIRE(value == expected--);
+        }
+        REQUIRE(std::distance(list.begin(), list.end()) == 1000);
+        REQUIRE(*(list.end() - 1) == 0);
+        REQUIRE(list.begin()[31] == 968);
+        REQUIRE(list.begin()[32] == 967);
+        auto it = list.begin() + 32;
+        --it;
+        REQUIRE(*it == 968);
+    }
+
+    SECTION("Work with random access algorithms") {
+        std::sort(list.begin(), list.end());
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(list[static_cast<size_t>(i)] == i);
+        }
+        const auto found = std::lower_bound(list.cbegin(), list.cend(), 500);
+        REQUIRE(found - list.cbegin() == 500);
+    }
+
+    SECTION("for_each_segment covers every element once") {
+        long long sum = 0;
+        size_t runs = 0;
+        const auto& view = list;
+        view.for_each_segment([&](const int* first, const size_t count) {
+            sum = std::accumulate(first, first + count, sum);
+            ++runs;
+        });
+        REQUIRE(sum == 999 * 1000 / 2);
+        REQUIRE(runs == 6);
+    }
+}
+
+TEST_CASE("SegmentedArrayList appends") {
+    al::SegmentedArrayList<std::string> list{"a"};
+    list.append(100, "b");
+    const std::forward_list<std::string> forward{"c", "d"};
+    list.append(forward.begin(), forward.end());
+    std::istringstream input("e f");
+    list.append(std::istream_iterator<std::string>(input),
+                std::istream_iterator<std::string>());
+    REQUIRE(list.size() == 105);
+    REQUIRE(list[100] == "b");
+    REQUIRE(list[102] == "d");
+    REQUIRE(list[104] == "f");
+}
+
+TEST_CASE("SegmentedArrayList rolls back throwing appends") {
+    CopyLimited::copies = 0;
+    CopyLimited::limit = 1000;
+    CopyLimited::live = 0;
+    {
+        al::SegmentedArrayList<CopyLimited> list;
+        for (int i = 0; i < 20; ++i) {
+            list.emplace_back(i);
+        }
+        CopyLimited::limit = CopyLimited::copies + 30;
+        REQUIRE_THROWS_AS(list.append(50, CopyLimited(-1)), std::runtime_error);
+        REQUIRE(list.size() == 20);
+        REQUIRE(CopyLimited::live == 20);
+    }
+    REQUIRE(CopyLimited::live == 0);
+}
+
+TEST_CASE("SegmentedArrayList copies, moves and converts") {
+    al::SegmentedArrayList<std::string> list;
+    for (int i = 0; i < 300; ++i) {
+        list.push_back(std::to_string(i));
+    }
+
+    SECTION("Copy and move") {
+        auto copy = list;
+        REQUIRE(copy == list);
+        const auto* const address = &copy[200];
+        auto moved = std::move(copy);
+        REQUIRE(&moved[200] == address);
+        REQUIRE(copy.empty());  // NOLINT
+
+        al::SegmentedArrayList<std::string> small{"x"};
+        small = list;
+        REQUIRE(small == list);
+        list.resize(10);
+        small = list;
+        REQUIRE(small.size() == 10);
+        small = std::move(moved);
+        REQUIRE(small.size() == 300);
+        swap(small, list);
+        REQUIRE(list.size() == 300);
+        REQUIRE(small.size() == 10);
+    }
+
+    SECTION("to_array_list copies") {
+        const auto contiguous = list.to_array_list();
+        REQUIRE(contiguous.size() == 300);
+        REQUIRE(contiguous.capacity() == 300);
+        REQUIRE(contiguous[299] == "299");
+        REQUIRE(list.size() == 300);
+    }
+
+    SECTION("freeze moves and releases the segments") {
+        const auto contiguous = list.freeze();
+        REQUIRE(contiguous.size() == 300);
+        REQUIRE(contiguous[0] == "0");
+        REQUIRE(contiguous[299] == "299");
+        REQUIRE(list.empty());
+        REQUIRE(list.capacity() == 0);
+        list.push_back("again");
+        REQUIRE(list.front() == "again");
+    }
+}
@@ -0,0 +1,204 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/serialize.hpp"
+
+namespace {
+
+struct Record {
+    double x;
+    std::uint32_t id;
+    char tag;
+};
+
+auto operator==(const Record& self, const Record& that) -> bool {
+    return self.x == that.x and self.id == that.id and self.tag == that.tag;
+}
+
+auto records(const std::uint32_t count) -> al::ArrayList<Record> {
+    al::ArrayList<Record> list;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        list.push_back({i * 0.5, i, static_cast<char>('a' + i % 26)});
+    }
+    return list;
+}
+
+/// Stores only the length of each string, to show a codec of one's own.
+struct LengthCodec {
+    void encode(al::ByteWriter& out, const std::string& value) const {
+        out.put(static_cast<std::uint8_t>(value.size()));
+    }
+
+    auto decode(al::ByteReader& in) const -> std::string {
+        return std::string(in.get<std::uint8_t>(), '?');
+    }
+};
+
+}  // namespace
+
+TEST_CASE("serialize round trips trivially copyable elements") {
+    const auto list = records(1000);
+
+    SECTION("Through a stream") {
+        std::stringstream stream;
+        al::serialize(stream, list);
+        REQUIRE(stream.str().size() ==
+                sizeof(al::detail::SerialHeader) + 1000 * sizeof(Record));
+
+        al::ArrayList<Record> copy;
+        copy.push_back({});
+        al::deserialize(stream, copy);
+        REQUIRE(copy == list);
+    }
+
+    SECTION("Through a FILE") {
+        std::FILE* const file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        al::serialize(file, list);
+        al::serialize(file, al::ArrayList<Record>());
+        std::rewind(file);
+
+        al::ArrayList<Record> copy;
+        al::deserialize(file, copy);
+        REQUIRE(copy == list);
+        al::deserialize(file, copy);
+        REQUIRE(copy.empty());
+        std::fclose(file);
+    }
+
+#if AL_HAS_POSIX_IO
+    SECTION("Through a file descriptor") {
+        std::FILE* const file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        const al::FileDescriptor fd{::fileno(file)};
+        al::serialize(fd, list);
+        REQUIRE(::lseek(fd.fd, 0, SEEK_SET) == 0);
+
+        al::ArrayList<Record> copy;
+        al::deserialize(fd, copy);
+        REQUIRE(copy == list);
+        std::fclose(file);
+    }
+#endif
+}
+
+TEST_CASE("serialize encodes other elements with a codec") {
+    al::ArrayList<std::string> list;
+    for (int i = 0; i < 500; ++i) {
+        list.push_back(std::string(static_cast<size_t>(i % 40), 'x') +
+                       std::to_string(i));
+    }
+    list.emplace_back();
+
+    std::stringstream stream;
+    al::serialize(stream, list);
+    al::ArrayList<std::string> copy;
+    al::deserialize(stream, copy);
+    REQUIRE(copy == list);
+
+    std::stringstream lengths;
+    al::serialize(lengths, list, LengthCodec{});
+    al::deserialize(lengths, copy, LengthCodec{});
+    REQUIRE(copy.size() == list.size());
+    REQUIRE(copy[45] == std::string(list[45].size(), '?'));
+}
+
+TEST_CASE("deserialize rejects what it cannot trust") {
+    std::stringstream stream;
+    al::serialize(stream, records(100));
+    const auto bytes = stream.str();
+
+    al::ArrayList<Record> list = records(3);
+    const auto rejects = [&list](const std::string& input) {
+        std::stringstream in(input);
+        REQUIRE_THROWS_AS(al::deserialize(in, list), al::SerializationError);
+        REQUIRE(list.empty());
+    };
+
+    rejects("");
+    rejects("not a list");
+    rejects(bytes.substr(0, bytes.size() - 1));
+
+    auto damaged = bytes;
+    damaged[sizeof(al::detail::SerialHeader) + 10] ^= 1;
+    rejects(damaged);
+
+    auto swapped = bytes;
+    swapped[5] = static_cast<char>(3 - swapped[5]);  // byte_order
+    rejects(swapped);
+
+    std::stringstream other(bytes);
+    al::ArrayList<std::uint64_t> wrong_type;
+    REQUIRE_THROWS_AS(al::deserialize(other, wrong_type),
+                      al::SerializationError);
+
+    std::stringstream strings(bytes);
+    al::ArrayList<std::string> encoded;
+    REQUIRE_THROWS_AS(al::deserialize(strings, encoded),
+                      al::SerializationError);
+
+#if AL_HAS_POSIX_IO
+    REQUIRE_THROWS_AS(al::deserialize(al::FileDescriptor{-1}, list),
+                      std::system_error);
+#endif
+}
+
+TEST_CASE("deserialize does not allocate for a damaged size") {
+    std::stringstream stream;
+    al::serialize(stream, records(100));
+    auto bytes = stream.str();
+
+    // A count within max_size, and a payload size to match it.
+    al::detail::SerialHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.count = std::uint64_t{1} << 40U;
+    header.bytes = header.count * sizeof(Record);
+    std::memcpy(&bytes[0], &header, sizeof(header));
+
+    al::ArrayList<Record> list;
+    SECTION("A source that knows its size fails before reading") {
+        std::stringstream in(bytes);
+        REQUIRE_THROWS_AS(al::deserialize(in, list), al::SerializationError);
+        REQUIRE(list.capacity() == 0);
+    }
+
+#if AL_HAS_POSIX_IO
+    SECTION("Any other fails once the input ends") {
+        int ends[2];
+        REQUIRE(::pipe(ends) == 0);
+        al::detail::write_all(
+            al::FileDescriptor{ends[1]},
+            {al::detail::ByteSpan{bytes.data(), bytes.size()}});
+        ::close(ends[1]);
+        REQUIRE_THROWS_AS(al::deserialize(al::FileDescriptor{ends[0]}, list),
+                          al::SerializationError);
+        ::close(ends[0]);
+        REQUIRE(list.empty());
+        REQUIRE(list.capacity() * sizeof(Record) <=
+                al::detail::PayloadChunkBytes);
+    }
+#endif
+
+    SECTION("Nor for the staging buffer of encoded elements") {
+        std::stringstream strings;
+        al::serialize(strings, al::ArrayList<std::string>{"a", "b"});
+        auto encoded = strings.str();
+        std::memcpy(&header, encoded.data(), sizeof(header));
+        header.bytes = std::uint64_t{1} << 40U;
+        std::memcpy(&encoded[0], &header, sizeof(header));
+
+        std::stringstream in(encoded);
+        al::ArrayList<std::string> copy;
+        REQUIRE_THROWS_AS(al::deserialize(in, copy), al::SerializationError);
+    }
+}
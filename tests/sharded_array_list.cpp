@@ -0,0 +1,134 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ArrayList
+#include "al/sharded_array_list.hpp"
+#include "detail.hpp"
+
+namespace {
+
+using detail::CopyLimited;
+
+/// A CopyLimited that cannot be moved without risk, so merging has to copy.
+struct CopyOnlyLimited : CopyLimited {
+    using CopyLimited::CopyLimited;
+    CopyOnlyLimited(const CopyOnlyLimited&) = default;
+};
+
+}  // namespace
+
+TEST_CASE("ShardedArrayList merges shards in index order") {
+    al::parallel::ThreadPool pool(4);
+
+    SECTION("Trivially copyable") {
+        al::ShardedArrayList<int> sharded;
+        for (int shard = 7; shard >= 0; --shard) {
+            for (int i = 0; i < 1000; ++i) {
+                sharded.shard(static_cast<size_t>(shard))
+                    .push_back(shard * 1000 + i);
+            }
+        }
+        REQUIRE(sharded.shard_count() == 8);
+        REQUIRE(sharded.size() == 8000);
+
+        const auto merged = sharded.merge(pool);
+        REQUIRE(merged.size() == 8000);
+        for (int value = 0; value < 8000; ++value) {
+            REQUIRE(merged[static_cast<size_t>(value)] == value);
+        }
+        REQUIRE(sharded.empty());
+        REQUIRE(sharded.shard(3).capacity() >= 1000);
+    }
+
+    SECTION("Appends to an existing list") {
+        al::ShardedArrayList<std::string> sharded;
+        sharded.shard(2).push_back("c");
+        sharded.shard(0).push_back("a");
+        sharded.shard(0).push_back("b");
+
+        al::ArrayList<std::string> output{"start"};
+        sharded.merge_into(output, pool);
+        REQUIRE(output == al::ArrayList<std::string>{"start", "a", "b", "c"});
+        REQUIRE(sharded.empty());
+    }
+}
+
+TEST_CASE("ShardedArrayList merge cleans up after a throwing copy") {
+    al::parallel::ThreadPool pool(2);
+    CopyLimited::copies = 0;
+    CopyLimited::limit = 1000;
+    CopyLimited::live = 0;
+    {
+        al::ShardedArrayList<CopyOnlyLimited> sharded;
+        for (int i = 0; i < 100; ++i) {
+            sharded.shard(static_cast<size_t>(i % 4)).emplace_back(i);
+        }
+        CopyLimited::limit = CopyLimited::copies + 50;
+
+        al::ArrayList<CopyOnlyLimited> output;
+        output.emplace_back(-1);
+        REQUIRE_THROWS_AS(sharded.merge_into(output, pool), std::runtime_error);
+        REQUIRE(output.size() == 1);
+        REQUIRE(sharded.size() == 100);
+        REQUIRE(CopyLimited::live == 101);
+
+        CopyLimited::limit = CopyLimited::copies + 1000;
+        sharded.merge_into(output, pool);
+        REQUIRE(output.size() == 101);
+        REQUIRE(output[26].value == 1);
+    }
+    REQUIRE(CopyLimited::live == 0);
+}
+
+TEST_CASE("ShardedArrayList gives each thread its own shard") {
+    constexpr int Producers = 8;
+    constexpr int PerProducer = 20000;
+    al::ShardedArrayList<int> sharded;
+    // Catch assertions are not thread-safe, so producers only count.
+    std::atomic<int> shared{0};
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < Producers; ++producer) {
+        producers.emplace_back([&sharded, &shared, producer] {
+            auto& shard = sharded.local();
+            for (int i = 0; i < PerProducer; ++i) {
+                if (&sharded.local() != &shard) {
+                    ++shared;
+                }
+                shard.push_back(producer * PerProducer + i);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(shared == 0);
+    REQUIRE(sharded.shard_count() == Producers);
+    auto merged = sharded.merge();
+    REQUIRE(merged.size() == Producers * PerProducer);
+    std::sort(merged.begin(), merged.end());
+    for (int value = 0; value < Producers * PerProducer; ++value) {
+        if (merged[static_cast<size_t>(value)] != value) {
+            FAIL("Missing " << value);
+        }
+    }
+
+    SECTION("A thread keeps its shard across lists") {
+        al::ShardedArrayList<int> other;
+        auto& mine = sharded.local();
+        auto& theirs = other.local();
+        REQUIRE(&sharded.local() == &mine);
+        REQUIRE(&other.local() == &theirs);
+        REQUIRE(sharded.shard_count() == Producers + 1);
+        REQUIRE(other.shard_count() == 1);
+    }
+}
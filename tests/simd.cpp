@@ -0,0 +1,167 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/simd.hpp"
+
+namespace {
+
+/// Runs `check` once per instruction set this machine supports.
+template <class Check>
+void for_each_isa(Check check) {
+    for (const auto isa : {al::simd::Isa::Scalar, al::simd::Isa::Sse2,
+                           al::simd::Isa::Avx2, al::simd::Isa::Avx512}) {
+        if (isa > al::simd::detected_isa()) {
+            break;
+        }
+        al::simd::limit_isa(isa);
+        check();
+    }
+    al::simd::limit_isa(al::simd::Isa::Avx512);
+}
+
+template <class Type>
+auto random_list(const size_t size, std::mt19937& engine)
+    -> al::ArrayList<Type> {
+    // A narrow range so values repeat and searches both hit and miss.
+    std::uniform_int_distribution<int> distribution(0, 50);
+    al::ArrayList<Type> list;
+    for (size_t i = 0; i < size; ++i) {
+        list.push_back(static_cast<Type>(distribution(engine)));
+    }
+    return list;
+}
+
+template <class Type>
+void check_against_std() {
+    std::mt19937 engine(7);
+    for (size_t size = 0; size < 300; size += size < 70 ? 1 : 37) {
+        const auto list = random_list<Type>(size, engine);
+        for (const auto value : {Type(0), Type(25), Type(51)}) {
+            REQUIRE(al::simd::find(list, value) ==
+                    std::find(list.begin(), list.end(), value));
+            REQUIRE(al::simd::count(list, value) ==
+                    static_cast<size_t>(
+                        std::count(list.begin(), list.end(), value)));
+            REQUIRE(al::simd::contains(list, value) ==
+                    (std::find(list.begin(), list.end(), value) != list.end()));
+        }
+        if (!list.empty()) {
+            REQUIRE(al::simd::min(list) ==
+                    *std::min_element(list.begin(), list.end()));
+            REQUIRE(al::simd::max(list) ==
+                    *std::max_element(list.begin(), list.end()));
+        }
+        // Small integers, so even floating point sums are exact.
+        REQUIRE(al::simd::sum(list) ==
+                std::accumulate(list.begin(), list.end(), Type(0)));
+
+        auto other = list;
+        REQUIRE(al::simd::equal(list, other));
+        REQUIRE(al::simd::compare(list, other) == 0);
+        if (!other.empty()) {
+            other[size / 2] = Type(60);
+            REQUIRE_FALSE(al::simd::equal(list, other));
+            REQUIRE(al::simd::compare(list, other) < 0);
+            REQUIRE(al::simd::compare(other, list) > 0);
+            other.pop_back();
+            REQUIRE(al::simd::compare(other, list) != 0);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("SIMD algorithms match the standard algorithms") {
+    for_each_isa([] {
+        check_against_std<char>();
+        check_against_std<unsigned char>();
+        check_against_std<std::int16_t>();
+        check_against_std<std::uint32_t>();
+        check_against_std<std::int64_t>();
+        check_against_std<float>();
+        check_against_std<double>();
+    });
+}
+
+TEST_CASE("SIMD algorithms on edge values") {
+    for_each_isa([] {
+        SECTION("Signed lanes order negative values first") {
+            al::ArrayList<std::int8_t> list(64);
+            list.resize(64);
+            list[40] = -100;
+            list[3] = 100;
+            REQUIRE(al::simd::min(list) == -100);
+            REQUIRE(al::simd::max(list) == 100);
+
+            al::ArrayList<std::int8_t> other = list;
+            other[3] = -1;
+            REQUIRE(al::simd::compare(other, list) < 0);
+        }
+
+        SECTION("Counts past the range of a byte") {
+            al::ArrayList<unsigned char> list;
+            list.resize(10000);
+            REQUIRE(al::simd::count(list, static_cast<unsigned char>(0)) ==
+                    10000);
+        }
+
+        SECTION("Integer sums wrap around") {
+            al::ArrayList<std::uint32_t> list;
+            for (int i = 0; i < 100; ++i) {
+                list.push_back(std::numeric_limits<std::uint32_t>::max());
+            }
+            REQUIRE(al::simd::sum(list) == static_cast<std::uint32_t>(-100));
+        }
+
+        SECTION("NaNs fall back to the standard order") {
+            al::ArrayList<float> list;
+            for (int i = 0; i < 40; ++i) {
+                list.push_back(static_cast<float>(i));
+            }
+            list[17] = std::numeric_limits<float>::quiet_NaN();
+            REQUIRE(al::simd::min(list) ==
+                    *std::min_element(list.begin(), list.end()));
+            REQUIRE(al::simd::max(list) ==
+                    *std::max_element(list.begin(), list.end()));
+            REQUIRE_FALSE(al::simd::equal(list, list));
+            REQUIRE_FALSE(al::simd::contains(
+                list, std::numeric_limits<float>::quiet_NaN()));
+        }
+
+        SECTION("Compare moves past unordered elements") {
+            const auto nan = std::numeric_limits<double>::quiet_NaN();
+            const al::ArrayList<double> first{nan, 1.0};
+            const al::ArrayList<double> second{nan, 2.0};
+            REQUIRE(al::simd::compare(first, second) < 0);
+            REQUIRE(al::simd::compare(second, first) > 0);
+            REQUIRE(std::lexicographical_compare(first.begin(), first.end(),
+                                                 second.begin(), second.end()));
+
+            const al::ArrayList<double> shorter{nan};
+            const al::ArrayList<double> longer{nan, 5.0};
+            REQUIRE(al::simd::compare(shorter, longer) < 0);
+            REQUIRE(al::simd::compare(longer, shorter) > 0);
+            REQUIRE(al::simd::compare(shorter, shorter) == 0);
+        }
+    });
+}
+
+TEST_CASE("SIMD algorithms fall back for other types") {
+    const al::ArrayList<std::string> list{"b", "a", "c"};
+    REQUIRE(al::simd::find(list, std::string("a")) == list.begin() + 1);
+    REQUIRE(al::simd::min(list) == "a");
+    REQUIRE(al::simd::sum(list) == "bac");
+    REQUIRE(al::simd::compare(list, al::ArrayList<std::string>{"b", "b"}) < 0);
+    REQUIRE_THROWS_AS(al::simd::max(al::ArrayList<std::string>()),
+                      std::out_of_range);
+}
@@ -0,0 +1,173 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/small_array_list.hpp"
+#include "detail.hpp"
+
+namespace {
+
+using detail::live_blocks;
+using detail::TaggedAllocator;
+
+int moves_left = -1;  // NOLINT
+
+/// Throws from its move constructor once `moves_left` runs out.
+struct ThrowingMove {
+    explicit ThrowingMove(const int value) noexcept : value(value) {}
+
+    ThrowingMove(const ThrowingMove&) = default;
+
+    ThrowingMove(ThrowingMove&& other) : value(other.value) {  // NOLINT
+        if (moves_left-- == 0) {
+            throw std::runtime_error("move");
+        }
+    }
+
+    int value;
+};
+
+}  // namespace
+
+TEST_CASE("SmallArrayList stays inline until it overflows") {
+    al::SmallArrayList<int, 8> list;
+    REQUIRE(list.empty());
+    REQUIRE(list.is_inline());
+    REQUIRE(list.capacity() == 8);
+
+    for (int i = 0; i < 8; ++i) {
+        list.push_back(i);
+    }
+    REQUIRE(list.is_inline());
+    REQUIRE(list.size() == 8);
+
+    list.push_back(8);
+    REQUIRE_FALSE(list.is_inline());
+    REQUIRE(list.capacity() == 12);
+    for (int i = 0; i < 9; ++i) {
+        REQUIRE(list[i] == i);
+    }
+}
+
+TEST_CASE("SmallArrayList with non trivial types") {
+    al::SmallArrayList<std::string, 2> list{"Hello", "World"};
+    REQUIRE(list.is_inline());
+
+    list.emplace_back(list.front());
+    REQUIRE_FALSE(list.is_inline());
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.back() == "Hello");
+
+    list.erase(list.cbegin() + 1);
+    REQUIRE(list.size() == 2);
+    REQUIRE(list[1] == "Hello");
+
+    list.resize(4);
+    REQUIRE(list.size() == 4);
+    REQUIRE(list.back().empty());
+
+    list.erase(list.cbegin(), list.cbegin() + 2);
+    REQUIRE(list.size() == 2);
+
+    list.pop_back();
+    list.pop_back();
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("SmallArrayList copy and move") {
+    SECTION("Inline") {
+        al::SmallArrayList<std::unique_ptr<int>, 4> list;
+        list.push_back(std::make_unique<int>(1));
+        list.push_back(std::make_unique<int>(2));
+
+        auto moved = std::move(list);
+        REQUIRE(moved.is_inline());
+        REQUIRE(moved.size() == 2);
+        REQUIRE(*moved[1] == 2);
+        REQUIRE(list.empty());  // NOLINT
+    }
+
+    SECTION("Heap") {
+        al::SmallArrayList<std::string, 1> list{"a", "b", "c"};
+        REQUIRE_FALSE(list.is_inline());
+        const auto* data = list.data();
+
+        al::SmallArrayList<std::string, 1> copy = list;
+        REQUIRE(copy == list);
+
+        al::SmallArrayList<std::string, 1> moved;
+        moved.push_back("x");
+        moved = std::move(list);
+        REQUIRE(moved.data() == data);
+        REQUIRE(moved == copy);
+        REQUIRE(list.is_inline());  // NOLINT
+        REQUIRE(list.empty());      // NOLINT
+    }
+}
+
+TEST_CASE("SmallArrayList move assignment respects the allocator") {
+    using List = al::SmallArrayList<std::string, 2,
+                                    TaggedAllocator<std::string>>;
+    {
+        const TaggedAllocator<std::string> zero(0);
+        List first(zero);
+        List second({"a", "b", "c"}, TaggedAllocator<std::string>(1));
+
+        // Unequal allocators: the elements move, the buffer stays.
+        const auto* data = second.data();
+        first = std::move(second);
+        REQUIRE(first == List({"a", "b", "c"}, zero));
+        REQUIRE(first.data() != data);
+        REQUIRE(second.empty());  // NOLINT
+        REQUIRE(live_blocks[0] == 1);
+        REQUIRE(live_blocks[1] == 1);
+
+        // Equal allocators: the buffer is adopted.
+        data = first.data();
+        List other(zero);
+        other = std::move(first);
+        REQUIRE(other.data() == data);
+        REQUIRE(live_blocks[0] == 1);
+    }
+    REQUIRE(live_blocks[0] == 0);
+    REQUIRE(live_blocks[1] == 0);
+}
+
+TEST_CASE("SmallArrayList copy assignment propagates the allocator") {
+    using List = al::SmallArrayList<std::string, 2,
+                                    TaggedAllocator<std::string>>;
+    {
+        List first({"a", "b", "c"}, TaggedAllocator<std::string>(0));
+        const List second({"x", "y", "z"}, TaggedAllocator<std::string>(1));
+        first = second;
+        REQUIRE(first == second);
+        REQUIRE(live_blocks[0] == 0);
+        REQUIRE(live_blocks[1] == 2);
+    }
+    REQUIRE(live_blocks[1] == 0);
+}
+
+TEST_CASE("SmallArrayList reserve frees the new buffer if a move throws") {
+    using List = al::SmallArrayList<ThrowingMove, 2,
+                                    TaggedAllocator<ThrowingMove>>;
+    List list(TaggedAllocator<ThrowingMove>(0));
+    list.emplace_back(1);
+    list.emplace_back(2);
+
+    moves_left = 1;
+    REQUIRE_THROWS_AS(list.reserve(8), std::runtime_error);
+    moves_left = -1;
+    REQUIRE(live_blocks[0] == 0);
+    REQUIRE(list.is_inline());
+    REQUIRE(list.size() == 2);
+    REQUIRE(list[0].value == 1);
+    REQUIRE(list[1].value == 2);
+}
@@ -0,0 +1,177 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+// ArrayList
+#include "al/soa_array_list.hpp"
+#include "detail.hpp"
+
+namespace {
+
+using Particles = al::SoAArrayList<float, std::uint32_t, std::string>;
+
+using detail::CopyLimited;
+
+auto is_aligned(const void* const data) -> bool {
+    return reinterpret_cast<std::uintptr_t>(data) % 64 == 0;
+}
+
+}  // namespace
+
+TEST_CASE("SoAArrayList keeps columns in step") {
+    Particles list;
+    REQUIRE(list.empty());
+    REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.swap_remove(0), std::out_of_range);
+    REQUIRE_THROWS_AS(list.front(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.back(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.erase(0), std::out_of_range);
+    for (std::uint32_t i = 0; i < 100; ++i) {
+        list.emplace_back(static_cast<float>(i) / 2, i, std::to_string(i));
+    }
+    list.push_back(std::make_tuple(1.5F, 100U, std::string("100")));
+
+    REQUIRE(list.size() == 101);
+    REQUIRE(list.capacity() >= 101);
+    REQUIRE(list.column<0>().size() == 101);
+    REQUIRE(list.column<1>()[100] == 100);
+    REQUIRE(list.column<2>()[42] == "42");
+    REQUIRE(is_aligned(list.column<0>().data()));
+    REQUIRE(is_aligned(list.column<1>().data()));
+    REQUIRE(is_aligned(list.column<2>().data()));
+
+    SECTION("Columns are plain contiguous ranges") {
+        const auto ids = list.column<1>();
+        REQUIRE(std::accumulate(ids.begin(), ids.end(), 0U) == 100 * 101 / 2);
+    }
+
+    SECTION("Rows read and write every field") {
+        auto row = list[7];
+        REQUIRE(row.get<2>() == "7");
+        row.get<1>() = 70;
+        REQUIRE(list.column<1>()[7] == 70);
+
+        auto [x, id, name] = list[8];
+        x = 0.25F;
+        REQUIRE(list.column<0>()[8] == 0.25F);
+        REQUIRE(id == 8);
+        REQUIRE(name == "8");
+
+        list[9] = std::make_tuple(9.5F, 90U, std::string("ninety"));
+        REQUIRE(list.at(9).values() == std::make_tuple(9.5F, 90U, "ninety"));
+        REQUIRE_THROWS_AS(list.at(101), std::out_of_range);
+
+        list[10] = list[9];
+        REQUIRE(list[10].values() == list[9].values());
+        REQUIRE(list[10].index() == 10);
+        auto source = static_cast<const Particles&>(list).begin();
+        std::advance(source, 9);
+        *list.begin() = *source;
+        REQUIRE(list[0].values() == list[9].values());
+
+        std::uint32_t expected = 0;
+        for (const auto row : static_cast<const Particles&>(list)) {
+            REQUIRE(row.index() == expected++);
+        }
+        REQUIRE(expected == 101);
+    }
+
+    SECTION("erase shifts every column") {
+        list.erase(0);
+        list.erase(10, 20);
+        REQUIRE(list.size() == 90);
+        REQUIRE_THROWS_AS(list.erase(90), std::out_of_range);
+        REQUIRE_THROWS_AS(list.erase(80, 91), std::out_of_range);
+        REQUIRE_THROWS_AS(list.erase(20, 10), std::out_of_range);
+        REQUIRE(list.size() == 90);
+        REQUIRE(list.front().get<1>() == 1);
+        REQUIRE(list[9].get<1>() == 10);
+        REQUIRE(list[10].get<1>() == 21);
+        REQUIRE(list[10].get<2>() == "21");
+    }
+
+    SECTION("swap_remove moves the last row in") {
+        list.swap_remove(3);
+        REQUIRE(list.size() == 100);
+        REQUIRE(list[3].get<1>() == 100);
+        REQUIRE(list[3].get<2>() == "100");
+        list.swap_remove(99);
+        REQUIRE(list.back().get<1>() == 98);
+        REQUIRE_THROWS_AS(list.swap_remove(99), std::out_of_range);
+    }
+
+    SECTION("resize, reserve and shrink_to_fit") {
+        list.resize(200);
+        REQUIRE(list.size() == 200);
+        REQUIRE(list.column<2>()[150].empty());
+        REQUIRE(list.column<1>()[150] == 0);
+        list.resize(10);
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 10);
+        REQUIRE(list[9].get<2>() == "9");
+        list.reserve(1000);
+        REQUIRE(list.capacity() == 1000);
+        REQUIRE(list[9].get<2>() == "9");
+        list.clear();
+        REQUIRE(list.empty());
+    }
+
+    SECTION("Copies, moves and swaps") {
+        auto copy = list;
+        REQUIRE(copy.size() == 101);
+        REQUIRE(copy[50].values() == list[50].values());
+        Particles other;
+        other.emplace_back(0.0F, 0U, "other");
+        other = list;
+        REQUIRE(other[100].get<2>() == "100");
+        auto moved = std::move(copy);
+        REQUIRE(moved.size() == 101);
+        REQUIRE(copy.empty());  // NOLINT
+        other.resize(1);
+        swap(moved, other);
+        REQUIRE(moved.size() == 1);
+        REQUIRE(other.size() == 101);
+    }
+
+    SECTION("Arguments may name fields of the list itself") {
+        while (list.size() < list.capacity()) {
+            list.emplace_back(0.0F, 0U, "filler");
+        }
+        list.emplace_back(list.column<0>()[1], list.column<1>()[1],
+                          list.column<2>()[1]);
+        REQUIRE(list.back().get<2>() == "1");
+    }
+}
+
+TEST_CASE("SoAArrayList leaves no half-built rows") {
+    using List = al::SoAArrayList<CopyLimited, CopyLimited>;
+    CopyLimited::copies = 0;
+    CopyLimited::live = 0;
+    {
+        List list;
+        list.emplace_back(1, 2);
+        const CopyLimited value(3);
+
+        CopyLimited::limit = CopyLimited::copies + 1;
+        REQUIRE_THROWS_AS(list.emplace_back(value, value), std::runtime_error);
+        REQUIRE(list.size() == 1);
+        REQUIRE(CopyLimited::live == 3);
+
+        CopyLimited::limit = CopyLimited::copies + 1;
+        REQUIRE_THROWS_AS(List(list), std::runtime_error);
+        REQUIRE(CopyLimited::live == 3);
+
+        CopyLimited::limit = CopyLimited::copies + 1000;
+        list.resize(50);
+        REQUIRE(list.column<1>()[0].value == 2);
+        REQUIRE(CopyLimited::live == 101);
+    }
+    REQUIRE(CopyLimited::live == 0);
+}
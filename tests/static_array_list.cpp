@@ -0,0 +1,121 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// ArrayList
+#include "al/static_array_list.hpp"
+
+namespace {
+
+int live = 0;         // NOLINT
+int copies_left = -1;  // NOLINT
+
+/// Counts live instances and throws from its copy constructor once
+/// `copies_left` runs out.
+struct Counted {
+    Counted() noexcept { ++live; }
+
+    Counted(const Counted& /* other */) {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copy");
+        }
+        ++live;
+    }
+
+    ~Counted() { --live; }
+
+    auto operator=(const Counted&) -> Counted& = default;
+};
+
+}  // namespace
+
+TEST_CASE("StaticArrayList stores its size in the smallest type") {
+    static_assert(
+        std::is_same<al::detail::SmallestSizeType<15>, std::uint8_t>::value);
+    static_assert(
+        std::is_same<al::detail::SmallestSizeType<256>, std::uint16_t>::value);
+    static_assert(std::is_same<al::detail::SmallestSizeType<70000>,
+                               std::uint32_t>::value);
+    static_assert(
+        std::is_same<al::StaticArrayList<char, 15>::size_type, size_t>::value);
+    static_assert(sizeof(al::StaticArrayList<char, 15>) == 16);
+    static_assert(
+        std::is_trivially_copyable<al::StaticArrayList<int, 4>>::value);
+}
+
+TEST_CASE("StaticArrayList checks indices before narrowing them") {
+    al::StaticArrayList<int, 10> list{1, 2, 3};
+    REQUIRE_THROWS_AS(list.at(256), std::out_of_range);
+    REQUIRE_THROWS_AS(list.resize(300), std::length_error);
+    REQUIRE_THROWS_AS(list.erase(list.cend()), std::out_of_range);
+    REQUIRE_THROWS_AS(list.erase(list.cbegin() + 2, list.cbegin() + 1),
+                      std::out_of_range);
+    REQUIRE_THROWS_AS(list.erase(list.cbegin(), list.cend() + 1),
+                      std::out_of_range);
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.at(2) == 3);
+}
+
+TEST_CASE("StaticArrayList in constant expressions") {
+    constexpr auto Build = [] {
+        al::StaticArrayList<int, 4> list{1, 2};
+        list.push_back(3);
+        list.emplace_back(4);
+        const auto pushed = list.try_push_back(5);
+        list.erase(list.cbegin());
+        return std::pair{list, pushed};
+    };
+    constexpr auto Result = Build();
+
+    static_assert(!Result.second);
+    static_assert(Result.first.size() == 3);
+    static_assert(Result.first.front() == 2);
+    static_assert(Result.first.back() == 4);
+}
+
+TEST_CASE("StaticArrayList never grows") {
+    al::StaticArrayList<std::string, 2> list;
+    REQUIRE(list.try_push_back("Hello"));
+    REQUIRE(list.try_emplace_back("World") != nullptr);
+    REQUIRE(list.full());
+
+    REQUIRE_FALSE(list.try_push_back("!"));
+    REQUIRE(list.try_emplace_back("!") == nullptr);
+    REQUIRE_THROWS_AS(list.push_back("!"), std::length_error);
+    REQUIRE(list.size() == 2);
+
+    auto copy = list;
+    REQUIRE(copy == list);
+
+    list.pop_back();
+    REQUIRE(list.size() == 1);
+    REQUIRE(list.back() == "Hello");
+    REQUIRE(copy != list);
+
+    list.resize(2);
+    REQUIRE(list.back().empty());
+    REQUIRE_THROWS_AS(list.resize(3), std::length_error);
+
+    list.clear();
+    REQUIRE(list.empty());
+}
+
+TEST_CASE("StaticArrayList destroys a partial copy when an element throws") {
+    using List = al::StaticArrayList<Counted, 4>;
+    {
+        List list;
+        list.resize(3);
+        REQUIRE(live == 3);
+
+        copies_left = 2;
+        REQUIRE_THROWS_AS(List(list), std::runtime_error);
+        copies_left = -1;
+        REQUIRE(live == 3);
+    }
+    REQUIRE(live == 0);
+}
@@ -4,8 +4,10 @@
 
 // StdLib
 #include <array>
+#include <iterator>
 #include <memory>
 #include <ranges>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -17,6 +19,29 @@
 // Other tests
 #include "c++11.hpp"
 
+namespace {
+
+struct RelocationTracked {
+    static inline int moves = 0;
+
+    RelocationTracked() = default;
+    explicit RelocationTracked(int value) : value(value) {}
+    RelocationTracked(const RelocationTracked&) = default;
+    RelocationTracked(RelocationTracked&& other) noexcept : value(other.value) {
+        ++moves;
+    }
+    ~RelocationTracked() {}  // NOLINT
+
+    int value = 0;
+};
+
+using detail::TaggedAllocator;
+
+}  // namespace
+
+template <>
+struct al::IsTriviallyRelocatable<RelocationTracked> : std::true_type {};
+
 TEST_CASE("Basic functionality") {
     al::ArrayList<int> list;
     REQUIRE(list.empty());
@@ -253,6 +278,113 @@ TEST_CASE("Construction from std::vector") {
     }
 }
 
+TEST_CASE("Trivially relocatable growth") {
+    static_assert(al::IsTriviallyRelocatable<int>::value);
+    static_assert(al::IsTriviallyRelocatable<std::unique_ptr<int>>::value);
+    static_assert(!al::IsTriviallyRelocatable<std::string>::value);
+
+    SECTION("Trivially copyable types keep their values") {
+        al::ArrayList<int> list;
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i);
+        }
+        REQUIRE(list.size() == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            REQUIRE(list[i] == i);
+        }
+    }
+
+    SECTION("unique_ptr is relocated without moving") {
+        al::ArrayList<std::unique_ptr<int>> list;
+        for (int i = 0; i < 100; ++i) {
+            list.push_back(std::make_unique<int>(i));
+        }
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(*list[i] == i);
+        }
+    }
+
+    SECTION("Opted in types are never move constructed on growth") {
+        RelocationTracked::moves = 0;
+        al::ArrayList<RelocationTracked> list;
+        for (int i = 0; i < 100; ++i) {
+            list.emplace_back(i);
+        }
+        REQUIRE(RelocationTracked::moves == 0);
+        for (int i = 0; i < 100; ++i) {
+            REQUIRE(list[i].value == i);
+        }
+    }
+}
+
+TEST_CASE("Growth policies") {
+    static_assert(sizeof(al::ArrayList<int>) == 3 * sizeof(int*));
+    static_assert(sizeof(al::ArrayList<int, std::allocator<int>,
+                                       al::GeometricGrowth<2, 1>>) ==
+                  3 * sizeof(int*));
+
+    SECTION("Geometric factors") {
+        constexpr al::GeometricGrowth<2, 1> Doubling;
+        constexpr al::GeometricGrowth<5, 4> Slow;
+        static_assert(Doubling(100, 101, 1000, 4) == 200);
+        static_assert(Slow(100, 101, 1000, 4) == 125);
+        static_assert(Doubling(600, 601, 1000, 4) == 1000);
+        static_assert(Slow(0, 1, 1000, 4) == 1);
+    }
+
+    SECTION("Page aligned") {
+        constexpr al::PageAlignedGrowth<> Paged;
+        static_assert(Paged(10, 11, 1UL << 40, 4) == 15);
+        static_assert(Paged(1024, 1025, 1UL << 40, 4) == 2048);
+        static_assert(Paged(1100, 1101, 1UL << 40, 4) % 1024 == 0);
+    }
+
+    SECTION("jemalloc size classes") {
+        static_assert(al::detail::jemalloc_size_class(1) == 8);
+        static_assert(al::detail::jemalloc_size_class(17) == 32);
+        static_assert(al::detail::jemalloc_size_class(129) == 160);
+        static_assert(al::detail::jemalloc_size_class(257) == 320);
+        static_assert(al::detail::jemalloc_size_class(4096) == 4096);
+
+        constexpr al::JemallocSizeClassGrowth<> SizeClassed;
+        // 15 * 24 = 360 bytes, rounded to the 384 byte class
+        static_assert(SizeClassed(10, 11, 1UL << 40, 24) == 16);
+    }
+
+    constexpr auto Fill = []<class Policy>(std::type_identity<Policy>) {
+        al::ArrayList<int, std::allocator<int>, Policy> list;
+        auto reallocations = 0;
+        for (int i = 0; i < 100000; ++i) {
+            const auto capacity = list.capacity();
+            list.push_back(i);
+            reallocations += capacity != list.capacity() ? 1 : 0;
+        }
+        REQUIRE(list.size() == 100000);
+        REQUIRE(list.back() == 99999);
+        return std::pair{reallocations, list.capacity()};
+    };
+
+    SECTION("Memory and reallocation trade-off") {
+        const auto [doubling_reallocs, doubling_capacity] =
+            Fill(std::type_identity<al::GeometricGrowth<2, 1>>{});
+        const auto [default_reallocs, default_capacity] =
+            Fill(std::type_identity<al::GeometricGrowth<>>{});
+        const auto [slow_reallocs, slow_capacity] =
+            Fill(std::type_identity<al::GeometricGrowth<5, 4>>{});
+        const auto [paged_reallocs, paged_capacity] =
+            Fill(std::type_identity<al::PageAlignedGrowth<>>{});
+        const auto [jemalloc_reallocs, jemalloc_capacity] =
+            Fill(std::type_identity<al::JemallocSizeClassGrowth<>>{});
+
+        REQUIRE(doubling_reallocs < default_reallocs);
+        REQUIRE(default_reallocs < slow_reallocs);
+        REQUIRE(slow_capacity <= default_capacity);
+        REQUIRE(paged_capacity * sizeof(int) % 4096 == 0);
+        REQUIRE(jemalloc_reallocs <= default_reallocs);
+        REQUIRE(jemalloc_capacity >= 100000);
+    }
+}
+
 TEST_CASE("Benchmark simple behavior") {
     constexpr auto WhatToDo =
         []<template <typename Type, typename = std::allocator<Type>>
@@ -299,3 +431,326 @@ TEST_CASE("C++11", "Simple Test") {
     // Perform the test
     cpp11_test::do_simple_test();
 }
+
+TEST_CASE("Default initializing growth") {
+    SECTION("resize_for_overwrite keeps existing values") {
+        al::ArrayList<int> list{1, 2, 3};
+        list.resize_for_overwrite(1000);
+        REQUIRE(list.size() == 1000);
+        REQUIRE(list[2] == 3);
+
+        list.resize_default_init(2);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list.back() == 2);
+    }
+
+    SECTION("Non trivial types are still constructed") {
+        al::ArrayList<std::string> list;
+        list.resize_default_init(3);
+        REQUIRE(list.size() == 3);
+        REQUIRE(list[1].empty());
+    }
+
+    SECTION("append_uninitialized returns the new tail") {
+        al::ArrayList<float> list{1.0F};
+        auto* tail = list.append_uninitialized(4);
+        REQUIRE(tail == list.data() + 1);
+        for (int i = 0; i < 4; ++i) {
+            tail[i] = static_cast<float>(i);
+        }
+        REQUIRE(list.size() == 5);
+        REQUIRE(list.back() == 3.0F);
+    }
+
+    SECTION("append_with keeps only what the writer produced") {
+        al::ArrayList<unsigned char> list;
+        const auto written =
+            list.append_with(64, [](unsigned char* tail, std::size_t count) {
+                REQUIRE(count == 64);
+                std::fill_n(tail, 10, static_cast<unsigned char>(7));
+                return 10;
+            });
+        REQUIRE(written == 10);
+        REQUIRE(list.size() == 10);
+        REQUIRE(list.capacity() >= 64);
+        REQUIRE(list.back() == 7);
+    }
+}
+
+TEST_CASE("Insert") {
+    SECTION("Single values") {
+        al::ArrayList<std::string> list{"a", "c"};
+        auto it = list.insert(list.cbegin() + 1, "b");
+        REQUIRE(*it == "b");
+        list.reserve(10);
+        list.insert(list.cbegin(), list.back());
+        list.emplace(list.cend(), 3, 'd');
+        REQUIRE(list == al::ArrayList<std::string>{"c", "a", "b", "c", "ddd"});
+    }
+
+    SECTION("Emplacing an element at the end of a full list") {
+        const std::string first(40, 'a');
+        al::ArrayList<std::string> list{first, "b"};
+        REQUIRE(list.size() == list.capacity());
+        list.emplace(list.cend(), list.front());
+        REQUIRE(list == al::ArrayList<std::string>{first, "b", first});
+
+        al::ArrayList<int> numbers{1, 2};
+        numbers.shrink_to_fit();
+        numbers.emplace(numbers.cend(), numbers[0]);
+        REQUIRE(numbers == al::ArrayList<int>{1, 2, 1});
+    }
+
+    SECTION("Repeated value aliasing an element") {
+        al::ArrayList<int> list{1, 2, 3};
+        list.reserve(10);
+        list.insert(list.cbegin(), 3, list[2]);
+        REQUIRE(list == al::ArrayList<int>{3, 3, 3, 1, 2, 3});
+    }
+
+    SECTION("Ranges grow at most once") {
+        al::ArrayList<std::string> list{"front", "back"};
+        std::vector<std::string> values(20, "middle");
+        list.insert(list.cbegin() + 1, values.begin(), values.end());
+        REQUIRE(list.size() == 22);
+        REQUIRE(list.capacity() == 22);
+        REQUIRE(list.front() == "front");
+        REQUIRE(list[21] == "back");
+        REQUIRE(list[10] == "middle");
+
+        list.insert_range(list.cend(), std::array<std::string, 2>{"x", "y"});
+        REQUIRE(list.back() == "y");
+    }
+
+    SECTION("Input iterators") {
+        al::ArrayList<int> list{1, 5};
+        std::istringstream stream("2 3 4");
+        list.insert(list.cbegin() + 1, std::istream_iterator<int>(stream),
+                    std::istream_iterator<int>());
+        REQUIRE(list == al::ArrayList<int>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("Initializer list into an empty list") {
+        al::ArrayList<int> list;
+        list.insert(list.cbegin(), {1, 2, 3});
+        list.insert(list.cbegin() + 1, {7});
+        REQUIRE(list == al::ArrayList<int>{1, 7, 2, 3});
+    }
+}
+
+TEST_CASE("Assign") {
+    SECTION("Repeated value") {
+        al::ArrayList<std::string> list{"a", "b", "c", "d"};
+        list.assign(2, "x");
+        REQUIRE(list == al::ArrayList<std::string>{"x", "x"});
+        list.assign(3, "y");
+        REQUIRE(list == al::ArrayList<std::string>{"y", "y", "y"});
+        REQUIRE(list.capacity() == 4);
+        list.assign(6, list[0]);
+        REQUIRE(list.size() == 6);
+        REQUIRE(list[5] == "y");
+    }
+
+    SECTION("Ranges shrink and grow over live elements") {
+        al::ArrayList<std::string> list{"a", "b", "c"};
+        const std::vector<std::string> longer{"1", "2", "3", "4", "5"};
+        list.reserve(10);
+        list.assign(longer.begin(), longer.end());
+        REQUIRE(list == al::ArrayList<std::string>(longer));
+        list.assign({"only"});
+        REQUIRE(list == al::ArrayList<std::string>{"only"});
+        REQUIRE(list.capacity() == 10);
+
+        list.assign_range(std::array<std::string, 2>{"p", "q"});
+        REQUIRE(list == al::ArrayList<std::string>{"p", "q"});
+    }
+
+    SECTION("Sub-range of itself") {
+        al::ArrayList<int> list{1, 2, 3, 4, 5};
+        list.assign(list.begin() + 2, list.end());
+        REQUIRE(list == al::ArrayList<int>{3, 4, 5});
+    }
+
+    SECTION("Input iterators") {
+        al::ArrayList<int> list{9, 9};
+        std::istringstream stream("1 2 3 4");
+        list.assign(std::istream_iterator<int>(stream),
+                    std::istream_iterator<int>());
+        REQUIRE(list == al::ArrayList<int>{1, 2, 3, 4});
+
+        std::istringstream shorter("7");
+        list.assign(std::istream_iterator<int>(shorter),
+                    std::istream_iterator<int>());
+        REQUIRE(list == al::ArrayList<int>{7});
+    }
+
+    SECTION("Copy assignment keeps the larger buffer") {
+        const al::ArrayList<std::string> source{"a", "b"};
+        al::ArrayList<std::string> target{"1", "2", "3", "4"};
+        target = source;
+        REQUIRE(target == source);
+        REQUIRE(target.capacity() == 4);
+    }
+}
+
+TEST_CASE("Comparison") {
+    SECTION("Lexicographical order") {
+        const al::ArrayList<int> list{1, 5, 2};
+        REQUIRE(list < al::ArrayList<int>{1, 6});
+        REQUIRE(list < al::ArrayList<int>{1, 5, 2, 0});
+        REQUIRE_FALSE(list < al::ArrayList<int>{1, 5, 2});
+        REQUIRE(al::ArrayList<int>{} < list);
+        REQUIRE(list > al::ArrayList<int>{-1, 9, 9});
+        REQUIRE(list >= al::ArrayList<int>{1, 5, 2});
+        REQUIRE(list <= al::ArrayList<int>{2});
+    }
+
+    SECTION("Unsigned bytes compare like memcmp") {
+        const al::ArrayList<unsigned char> list{1, 200, 3};
+        REQUIRE(list < al::ArrayList<unsigned char>{1, 201});
+        REQUIRE(al::ArrayList<unsigned char>{1, 200} < list);
+        REQUIRE(list == al::ArrayList<unsigned char>{1, 200, 3});
+    }
+}
+
+TEST_CASE("Batch erase") {
+    SECTION("Ranges") {
+        al::ArrayList<std::string> list{"a", "b", "c", "d", "e"};
+        auto it = list.erase(list.cbegin() + 1, list.cbegin() + 3);
+        REQUIRE(*it == "d");
+        REQUIRE(list == al::ArrayList<std::string>{"a", "d", "e"});
+
+        it = list.erase(list.cbegin(), list.cbegin());
+        REQUIRE(it == list.begin());
+        REQUIRE(list.size() == 3);
+
+        list.erase(list.cbegin(), list.cend());
+        REQUIRE(list.empty());
+    }
+
+    SECTION("Trivially relocatable types") {
+        al::ArrayList<std::unique_ptr<int>> list;
+        for (int i = 0; i < 6; ++i) {
+            list.push_back(std::make_unique<int>(i));
+        }
+        list.erase(list.cbegin() + 1, list.cbegin() + 4);
+        REQUIRE(list.size() == 3);
+        REQUIRE(*list[0] == 0);
+        REQUIRE(*list[1] == 4);
+        REQUIRE(*list[2] == 5);
+    }
+
+    SECTION("erase and erase_if") {
+        al::ArrayList<int> list{1, 2, 3, 4, 5, 6, 2};
+        REQUIRE(al::erase_if(list, [](int value) { return value % 2 == 1; }) ==
+                3);
+        REQUIRE(list == al::ArrayList<int>{2, 4, 6, 2});
+        REQUIRE(al::erase(list, 2) == 2);
+        REQUIRE(list == al::ArrayList<int>{4, 6});
+    }
+
+    SECTION("Erasing past the end throws") {
+        al::ArrayList<int> list{1};
+        REQUIRE_THROWS_AS(list.erase(1), std::out_of_range);
+    }
+}
+
+TEST_CASE("Swap remove") {
+    al::ArrayList<std::string> list{"a", "b", "c", "d"};
+    auto it = list.swap_remove(1);
+    REQUIRE(*it == "d");
+    REQUIRE(list == al::ArrayList<std::string>{"a", "d", "c"});
+
+    list.unordered_erase(list.cend() - 1);
+    REQUIRE(list == al::ArrayList<std::string>{"a", "d"});
+
+    REQUIRE_THROWS_AS(list.swap_remove(2), std::out_of_range);
+}
+
+TEST_CASE("pop_back destroys the last element") {
+    static int destroyed = 0;
+    struct Foo {
+        ~Foo() { ++destroyed; }
+    };
+    al::ArrayList<Foo> list;
+    list.emplace_back();
+    list.emplace_back();
+    destroyed = 0;
+    list.pop_back();
+    REQUIRE(destroyed == 1);
+    REQUIRE(list.size() == 1);
+}
+
+TEST_CASE("Shrinking") {
+    SECTION("shrink_to_fit") {
+        al::ArrayList<std::string> list{"a", "b"};
+        list.reserve(100);
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 2);
+        REQUIRE(list == al::ArrayList<std::string>{"a", "b"});
+
+        list.clear();
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 0);
+        REQUIRE(list.data() == nullptr);
+    }
+
+    SECTION("shrink_to keeps the elements") {
+        al::ArrayList<int> list{1, 2, 3};
+        list.reserve(100);
+        list.shrink_to(10);
+        REQUIRE(list.capacity() == 10);
+        list.shrink_to(1);
+        REQUIRE(list.capacity() == 3);
+        list.shrink_to(50);
+        REQUIRE(list.capacity() == 3);
+        REQUIRE(list == al::ArrayList<int>{1, 2, 3});
+    }
+
+    SECTION("Automatic reclamation after repeated low occupancy clears") {
+        constexpr auto SteadyState =
+            []<class Policy>(std::type_identity<Policy>) {
+                al::ArrayList<int, std::allocator<int>, Policy> list;
+                list.resize(100000);
+                list.clear();
+                for (int round = 0; round < 8; ++round) {
+                    list.resize(100);
+                    list.clear();
+                }
+                return list.capacity();
+            };
+
+        REQUIRE(SteadyState(std::type_identity<al::GeometricGrowth<>>{}) ==
+                100000);
+        REQUIRE(SteadyState(std::type_identity<al::ReclaimingGrowth<>>{}) ==
+                150);
+    }
+
+    SECTION("Hysteresis keeps the buffer for alternating batches") {
+        al::ArrayList<int, std::allocator<int>, al::ReclaimingGrowth<>> list;
+        for (int round = 0; round < 16; ++round) {
+            list.resize(round % 2 == 0 ? 1000 : 10);
+            list.clear();
+        }
+        REQUIRE(list.capacity() == 1000);
+    }
+
+    SECTION("Move assignment between unequal allocators keeps the buffer") {
+        using List = al::ArrayList<int, TaggedAllocator<int>,
+                                   al::ReclaimingGrowth<al::GeometricGrowth<>,
+                                                        1>>;
+        List list(TaggedAllocator<int>(0));
+        list.resize(100);
+        list.resize(1);
+        const auto* const data = list.data();
+
+        List other(TaggedAllocator<int>(1));
+        other.push_back(1);
+        other.push_back(2);
+        list = std::move(other);
+        REQUIRE(list.data() == data);
+        REQUIRE(list.capacity() == 100);
+        REQUIRE(list.size() == 2);
+        REQUIRE(list[1] == 2);
+    }
+}
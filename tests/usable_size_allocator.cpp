@@ -0,0 +1,153 @@
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <memory>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/usable_size_allocator.hpp"
+
+namespace {
+
+int allocations = 0;  // NOLINT
+
+/// Hands out room for a whole multiple of 64 elements, like an allocator
+/// with size classes would.
+template <class Type>
+struct RoundingAllocator {
+    using value_type = Type;  // NOLINT
+
+    RoundingAllocator() = default;
+
+    template <class Other>
+    RoundingAllocator(  // NOLINT
+        const RoundingAllocator<Other>& /* other */) noexcept {}
+
+    auto allocate(const size_t count) -> Type* {
+        return allocate_at_least(count).ptr;
+    }
+
+    auto allocate_at_least(const size_t count) -> al::AllocationResult<Type*> {
+        ++allocations;
+        const auto rounded = (count + 63) / 64 * 64;
+        return {std::allocator<Type>().allocate(rounded), rounded};
+    }
+
+    void deallocate(Type* const ptr, const size_t count) noexcept {
+        // Sized deallocation checks that the list kept the real count.
+        std::allocator<Type>().deallocate(ptr, count);
+    }
+
+    friend auto operator==(const RoundingAllocator& /* self */,
+                           const RoundingAllocator& /* that */) noexcept
+        -> bool {
+        return true;
+    }
+
+    friend auto operator!=(const RoundingAllocator& /* self */,
+                           const RoundingAllocator& /* that */) noexcept
+        -> bool {
+        return false;
+    }
+};
+
+struct Record {
+    double x, y, z;
+};
+
+}  // namespace
+
+TEST_CASE("Only lists that can be handed slack remember their last fit") {
+    static_assert(sizeof(al::ArrayList<int>) == 3 * sizeof(int*));
+    static_assert(sizeof(al::ArrayList<std::string>) ==
+                  3 * sizeof(std::string*));
+    static_assert(
+        sizeof(al::ArrayList<Record, RoundingAllocator<Record>>) ==
+        3 * sizeof(Record*) + 2 * sizeof(size_t));
+}
+
+TEST_CASE("ArrayList grows into the slack allocate_at_least reports") {
+    allocations = 0;
+    al::ArrayList<std::string, RoundingAllocator<std::string>> list;
+    list.reserve(1000);
+    REQUIRE(list.capacity() == 1024);
+    REQUIRE(allocations == 1);
+
+    for (int i = 0; i < 1024; ++i) {
+        list.emplace_back(std::to_string(i));
+    }
+    REQUIRE(allocations == 1);
+    list.emplace_back("more");
+    REQUIRE(allocations == 2);
+    REQUIRE(list.capacity() % 64 == 0);
+
+    SECTION("Inserts and assignments keep the real capacity too") {
+        list.insert(list.begin(), std::string("front"));
+        list.assign(5000, std::string("x"));
+        REQUIRE(list.capacity() == 5056);
+        const al::ArrayList<std::string, RoundingAllocator<std::string>> sized(
+            10);
+        REQUIRE(sized.capacity() == 64);
+    }
+}
+
+TEST_CASE("UsableSizeAllocator reports what malloc set aside") {
+    al::ArrayList<Record, al::UsableSizeAllocator<Record>> list;
+    list.reserve(1000);
+    const auto capacity = list.capacity();
+    const auto* const data = list.data();
+    REQUIRE(capacity >= 1000);
+
+    while (list.size() < capacity) {
+        list.push_back({1, 2, 3});
+    }
+    REQUIRE(list.data() == data);
+    list.push_back({4, 5, 6});
+    REQUIRE(list.capacity() > capacity);
+    REQUIRE(list.back().z == 6);
+    REQUIRE(list.front().x == 1);
+}
+
+TEST_CASE("Shrinking again to the same size keeps the rounded block") {
+    allocations = 0;
+
+    SECTION("shrink_to_fit") {
+        al::ArrayList<int, RoundingAllocator<int>> list;
+        list.reserve(1000);
+        list.resize(100);
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 128);
+        REQUIRE(allocations == 2);
+
+        list.shrink_to_fit();
+        list.shrink_to(110);
+        REQUIRE(list.capacity() == 128);
+        REQUIRE(allocations == 2);
+
+        list.resize(10);
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 64);
+        REQUIRE(allocations == 3);
+    }
+
+    SECTION("A reclaiming clear") {
+        al::ArrayList<int, RoundingAllocator<int>, al::ReclaimingGrowth<>>
+            list;
+        list.reserve(1000);
+        const auto clear_small_batches = [&list] {
+            for (int round = 0; round < 4; ++round) {
+                list.resize(10);
+                list.clear();
+            }
+        };
+        clear_small_batches();
+        REQUIRE(list.capacity() == 64);
+        REQUIRE(allocations == 2);
+
+        clear_small_batches();
+        REQUIRE(list.capacity() == 64);
+        REQUIRE(allocations == 2);
+    }
+}
@@ -0,0 +1,104 @@
+#if defined(__unix__) || defined(__APPLE__)
+
+// Testing
+#include <catch2/catch_test_macros.hpp>
+
+// StdLib
+#include <cstdint>
+#include <string>
+
+// ArrayList
+#include "al/array_list.hpp"
+#include "al/virtual_memory_allocator.hpp"
+
+namespace {
+
+constexpr size_t Reservation = size_t{64} << 20U;
+
+using List = al::VirtualArrayList<std::uint64_t>;
+
+#if defined(__linux__)
+/// How many pages of `[first, first + bytes)` are in memory.
+auto resident_pages(const void* const first, const size_t bytes) -> size_t {
+    const auto pages = bytes / al::detail::page_size();
+    std::string residency(pages, '\0');
+    REQUIRE(::mincore(const_cast<void*>(first), bytes,
+                      reinterpret_cast<unsigned char*>(&residency[0])) == 0);
+    size_t resident = 0;
+    for (const auto page : residency) {
+        resident += static_cast<size_t>(page & 1);
+    }
+    return resident;
+}
+#endif
+
+}  // namespace
+
+TEST_CASE("VirtualArrayList grows without moving") {
+    List list{al::VirtualMemoryAllocator<std::uint64_t>(Reservation)};
+    list.push_back(0);
+    const auto* const data = list.data();
+
+    constexpr std::uint64_t Count = Reservation / sizeof(std::uint64_t);
+    for (std::uint64_t i = 1; i < Count; ++i) {
+        list.push_back(i);
+    }
+    REQUIRE(list.data() == data);
+    REQUIRE(list[Count / 2] == Count / 2);
+    REQUIRE(list.back() == Count - 1);
+
+    SECTION("Past the reservation it relocates like any list") {
+        list.push_back(Count);
+        REQUIRE(list.data() != data);
+        REQUIRE(list.size() == Count + 1);
+        REQUIRE(list[Count / 3] == Count / 3);
+        REQUIRE(list.back() == Count);
+    }
+
+    SECTION("Shrinking decommits in place") {
+        list.resize(1000);
+        list.shrink_to_fit();
+        REQUIRE(list.data() == data);
+        REQUIRE(list.capacity() == 1000);
+        REQUIRE(list[999] == 999);
+#if defined(__linux__)
+        REQUIRE(resident_pages(data, Reservation) <= 2);
+#endif
+
+        list.clear();
+        list.shrink_to_fit();
+        REQUIRE(list.capacity() == 0);
+        list.push_back(7);
+        REQUIRE(list.data() == data);
+        REQUIRE(list.front() == 7);
+    }
+
+    SECTION("Copies get a reservation of their own") {
+        const auto copy = list;
+        REQUIRE(copy.data() != data);
+        REQUIRE(copy == list);
+    }
+}
+
+TEST_CASE("VirtualArrayList decommits when a reclaiming clear shrinks it") {
+    using Reclaiming =
+        al::VirtualArrayList<std::string, al::ReclaimingGrowth<>>;
+    Reclaiming list;
+    for (int i = 0; i < 10000; ++i) {
+        list.emplace_back(std::to_string(i));
+    }
+    const auto* const data = list.data();
+    const auto capacity = list.capacity();
+    list.clear();
+
+    for (int round = 0; round < 4; ++round) {
+        list.emplace_back("small");
+        list.clear();
+    }
+    REQUIRE(list.capacity() < capacity);
+    REQUIRE(list.data() == data);
+    list.emplace_back("again");
+    REQUIRE(list.front() == "again");
+}
+
+#endif